@@ -0,0 +1,21 @@
+#include "benchmarks.h"
+#include "benchmarking_framework.h"
+
+int main() {
+  BenchmarkRunner runner;
+
+  runner.RunBenchmark(BenchmarkIteratorChecks, "BenchmarkIteratorChecks");
+  runner.RunBenchmark(BenchmarkIndexedFind, "BenchmarkIndexedFind");
+  runner.RunBenchmark(BenchmarkPredicateAlgorithms, "BenchmarkPredicateAlgorithms");
+  runner.RunBenchmark(BenchmarkConcurrentList, "BenchmarkConcurrentList");
+  runner.RunBenchmark(BenchmarkCompactList, "BenchmarkCompactList");
+  runner.RunBenchmark(BenchmarkPositionalAccess, "BenchmarkPositionalAccess");
+  runner.RunBenchmark(BenchmarkBulkConstructionAndExport, "BenchmarkBulkConstructionAndExport");
+  runner.RunBenchmark(BenchmarkCompact, "BenchmarkCompact");
+  runner.RunBenchmark(BenchmarkLruCache, "BenchmarkLruCache");
+  runner.RunBenchmark(BenchmarkCopyAndMove, "BenchmarkCopyAndMove");
+  runner.RunBenchmark(BenchmarkEraseRange, "BenchmarkEraseRange");
+  runner.RunBenchmark(BenchmarkParallelAlgorithms, "BenchmarkParallelAlgorithms");
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+//
+// Created by user on 18.10.2026.
+//
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <string>
+
+#include <malloc.h>
+#include <sys/resource.h>
+
+#include "benchmarking_framework.h"
+
+namespace {
+
+// Updated from every thread of the concurrent benchmarks
+std::atomic<size_t> allocations_count(0);
+std::atomic<size_t> allocated_bytes(0);
+
+}  // namespace
+
+void* operator new(size_t size) {
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  allocations_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(malloc_usable_size(pointer), std::memory_order_relaxed);
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+  if (pointer != nullptr) {
+    allocated_bytes.fetch_sub(malloc_usable_size(pointer), std::memory_order_relaxed);
+    std::free(pointer);
+  }
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+AllocationStats CurrentAllocationStats() {
+  return {allocations_count.load(std::memory_order_relaxed), allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+size_t PeakRssKilobytes() {
+  std::ifstream status("/proc/self/status");
+  std::string field;
+  while (status >> field) {
+    if (field == "VmHWM:") {
+      size_t kilobytes = 0;
+      status >> kilobytes;
+      return kilobytes;
+    }
+  }
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<size_t>(usage.ru_maxrss);
+}
+
+void ResetPeakRss() {
+  // Return the memory freed by earlier workloads to the system first
+  malloc_trim(0);
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  if (clear_refs) {
+    clear_refs << "5";
+  }
+}
+
+void ReportNanosecondsPerOperation(const std::string& name, double nanoseconds, size_t operations_count) {
+  std::cout << "  " << std::left << std::setw(48) << name
+            << std::right << std::fixed << std::setprecision(3) << std::setw(12)
+            << nanoseconds / operations_count << " ns/op" << std::endl;
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+  if (fail_count > 0) {
+    std::cerr << fail_count << " benchmarks failed. Terminate" << std::endl;
+    exit(1);
+  }
+}
@@ -0,0 +1,85 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Keeps the compiler from optimizing away a value that is computed
+// only to be measured.
+template<class T>
+void DoNotOptimize(const T& value);
+
+// Runs func() 'repetitions' times and returns the best wall time of a single
+// run in nanoseconds.
+template<class Func>
+double MeasureNanoseconds(Func func, int repetitions = 5);
+
+void ReportNanosecondsPerOperation(const std::string& name, double nanoseconds, size_t operations_count);
+
+// Heap statistics collected by the replaced global operator new/delete
+// of the benchmark binary
+struct AllocationStats {
+  size_t allocations_count;
+  size_t allocated_bytes;
+};
+
+AllocationStats CurrentAllocationStats();
+
+// Peak resident set size of the process in kilobytes. ResetPeakRss lowers the
+// peak to the current resident size where the kernel allows it (Linux), so
+// that the peak of a single workload can be measured.
+size_t PeakRssKilobytes();
+void ResetPeakRss();
+
+class BenchmarkRunner {
+ public:
+  template<class BenchmarkFunc>
+  void RunBenchmark(BenchmarkFunc func, const std::string& benchmark_name);
+  ~BenchmarkRunner();
+
+ private:
+  int fail_count = 0;
+};
+
+template<class T>
+void DoNotOptimize(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+template<class Func>
+double MeasureNanoseconds(Func func, int repetitions) {
+  double best = 0;
+  for (int i = 0; i < repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto finish = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double, std::nano>(finish - start).count();
+    if (i == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+template<class BenchmarkFunc>
+void BenchmarkRunner::RunBenchmark(BenchmarkFunc func, const std::string& benchmark_name) {
+  std::cout << benchmark_name << ':' << std::endl;
+  try {
+    func();
+  } catch (std::exception& e) {
+    ++fail_count;
+    std::cerr << benchmark_name << " fail: " << e.what() << std::endl;
+  } catch (...) {
+    ++fail_count;
+    std::cerr << "Unknown exception caught" << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+#endif //BENCHMARK_RUNNER_H
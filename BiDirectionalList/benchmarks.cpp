@@ -0,0 +1,606 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <cmath>
+
+#include "benchmarking_framework.h"
+#include "list.h"
+#include "indexed_list.h"
+#include "concurrent_list.h"
+#include "compact_list.h"
+#include "order_statistics_list.h"
+#include "lru_cache.h"
+#include "benchmarks.h"
+
+namespace {
+
+struct Point {
+  int x;
+  int y;
+};
+
+const size_t kLargeListSize = 1'000'000;
+const size_t kFindListSize = 10'000;
+const size_t kFindQueriesCount = 10'000;
+const size_t kPositionalListSize = 100'000;
+const size_t kPositionalQueriesCount = 1'000;
+
+template<typename List>
+void MeasureIteration(const std::string& name) {
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+  List list(values);
+
+  double forward = MeasureNanoseconds([&list] {
+    long long sum = 0;
+    for (auto iterator = list.begin(); iterator != list.end(); ++iterator) {
+      sum += *iterator;
+    }
+    DoNotOptimize(sum);
+  });
+  ReportNanosecondsPerOperation(name + " forward", forward, list.Size());
+
+  double backward = MeasureNanoseconds([&list] {
+    long long sum = 0;
+    auto iterator = list.end();
+    while (iterator != list.begin()) {
+      sum += *(--iterator);
+    }
+    DoNotOptimize(sum);
+  });
+  ReportNanosecondsPerOperation(name + " backward", backward, list.Size());
+}
+
+template<typename List>
+void MeasureFind(const std::string& name) {
+  std::vector<int> values(kFindListSize);
+  std::iota(values.begin(), values.end(), 0);
+  List list(values);
+
+  std::mt19937 generator(2018);
+  std::vector<int> queries(kFindQueriesCount);
+  for (int& query : queries) {
+    query = generator() % (2 * kFindListSize);
+  }
+
+  double elapsed = MeasureNanoseconds([&list, &queries] {
+    size_t found = 0;
+    for (int query : queries) {
+      found += (list.Find(query) != list.end());
+    }
+    DoNotOptimize(found);
+  });
+  ReportNanosecondsPerOperation(name + " Find", elapsed, queries.size());
+}
+
+template<typename List, typename Value>
+void MeasureFootprint(const std::string& name, size_t elements_count) {
+  AllocationStats before = CurrentAllocationStats();
+  List list;
+  for (size_t i = 0; i < elements_count; ++i) {
+    list.PushBack(Value{});
+  }
+  AllocationStats after = CurrentAllocationStats();
+  std::cout << "  " << name << ": " << (after.allocated_bytes - before.allocated_bytes) / elements_count
+            << " heap bytes/element, " << after.allocations_count - before.allocations_count
+            << " allocations" << std::endl;
+
+  double elapsed = MeasureNanoseconds([&list] {
+    size_t count = 0;
+    for (auto iterator = list.begin(); iterator != list.end(); ++iterator) {
+      DoNotOptimize(*iterator);
+      ++count;
+    }
+    DoNotOptimize(count);
+  });
+  ReportNanosecondsPerOperation(name + " traversal", elapsed, elements_count);
+}
+
+const size_t kZipfKeysCount = 100'000;
+
+// Keys 0..keys_count-1, the key k is drawn with probability proportional to 1/(k+1)^exponent
+std::vector<int> ZipfianKeys(size_t keys_count, double exponent, size_t samples_count) {
+  std::vector<double> weights(keys_count);
+  for (size_t k = 0; k < keys_count; ++k) {
+    weights[k] = 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+  }
+  std::mt19937 generator(2018);
+  std::discrete_distribution<int> distribution(weights.begin(), weights.end());
+  std::vector<int> keys(samples_count);
+  for (int& key : keys) {
+    key = distribution(generator);
+  }
+  return keys;
+}
+
+// What the recency list of a hand-rolled cache looks like: a hit is found
+// by the linear Find and moved to the front by erase + push
+class LinearLruCache {
+ public:
+  explicit LinearLruCache(size_t capacity) : capacity_(capacity) {}
+
+  bool Get(int key) {
+    auto found = entries_.FindIf([key](const std::pair<int, int>& entry) { return entry.first == key; });
+    if (found == entries_.end()) {
+      return false;
+    }
+    std::pair<int, int> entry = *found;
+    entries_.Erase(found);
+    entries_.PushFront(entry);
+    return true;
+  }
+
+  void Put(int key, int value) {
+    entries_.PushFront({key, value});
+    if (entries_.Size() > capacity_) {
+      entries_.PopBack();
+    }
+  }
+
+ private:
+  size_t capacity_;
+  BiDirectionalList<std::pair<int, int>> entries_;
+};
+
+template<typename Cache>
+void MeasureCache(const std::string& name, Cache& cache, const std::vector<int>& keys) {
+  size_t hits_count = 0;
+  double elapsed = MeasureNanoseconds([&cache, &keys, &hits_count] {
+    for (int key : keys) {
+      if (cache.Get(key)) {
+        ++hits_count;
+      } else {
+        cache.Put(key, key);
+      }
+    }
+  }, 1);
+  ReportNanosecondsPerOperation(name, elapsed, keys.size());
+  std::cout << "  hit rate: " << 100.0 * hits_count / keys.size() << "%" << std::endl;
+}
+
+const int kConcurrentOperationsPerThread = 200'000;
+
+// Every thread owns a region of the shared list and inserts and erases
+// around its own elements: the workload where per-node locking can scale
+class GlobalMutexWorkload {
+ public:
+  void Prepare(int threads_count) {
+    iterators_.assign(threads_count, {});
+  }
+
+  void Run(int thread_index) {
+    std::mt19937 generator(thread_index);
+    std::vector<BiDirectionalList<int>::Iterator>& iterators = iterators_[thread_index];
+    for (int i = 0; i < 16; ++i) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      list_.PushBack(i);
+      iterators.push_back(--list_.end());
+    }
+    for (int i = 0; i < kConcurrentOperationsPerThread; ++i) {
+      size_t index = generator() % iterators.size();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (generator() % 2 == 0 || iterators.size() == 1) {
+        list_.InsertAfter(iterators[index], i);
+        iterators.push_back(++BiDirectionalList<int>::Iterator(iterators[index]));
+      } else {
+        list_.Erase(iterators[index]);
+        iterators[index] = iterators.back();
+        iterators.pop_back();
+      }
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  BiDirectionalList<int> list_;
+  std::vector<std::vector<BiDirectionalList<int>::Iterator>> iterators_;
+};
+
+class ConcurrentListWorkload {
+ public:
+  void Prepare(int threads_count) {
+    iterators_.assign(threads_count, {});
+  }
+
+  void Run(int thread_index) {
+    std::mt19937 generator(thread_index);
+    std::vector<ConcurrentList<int>::Iterator>& iterators = iterators_[thread_index];
+    {
+      ConcurrentList<int>::Guard guard;
+      for (int i = 0; i < 16; ++i) {
+        iterators.push_back(list_.PushBack(guard, i));
+      }
+    }
+    for (int i = 0; i < kConcurrentOperationsPerThread; ++i) {
+      ConcurrentList<int>::Guard guard;
+      size_t index = generator() % iterators.size();
+      if (generator() % 2 == 0 || iterators.size() == 1) {
+        iterators.push_back(list_.InsertAfter(guard, iterators[index], i));
+      } else {
+        list_.Erase(guard, iterators[index]);
+        iterators[index] = iterators.back();
+        iterators.pop_back();
+      }
+    }
+  }
+
+ private:
+  ConcurrentList<int> list_;
+  std::vector<std::vector<ConcurrentList<int>::Iterator>> iterators_;
+};
+
+template<typename Workload>
+void MeasureConcurrentThroughput(const std::string& name, int threads_count) {
+  double elapsed = MeasureNanoseconds([threads_count] {
+    Workload workload;
+    workload.Prepare(threads_count);
+    std::vector<std::thread> threads;
+    for (int thread_index = 0; thread_index < threads_count; ++thread_index) {
+      threads.emplace_back([&workload, thread_index] { workload.Run(thread_index); });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }, 3);
+  size_t operations_count = static_cast<size_t>(threads_count) * kConcurrentOperationsPerThread;
+  ReportNanosecondsPerOperation(name + ", " + std::to_string(threads_count) + " threads",
+                                elapsed, operations_count);
+}
+
+}  // namespace
+
+void BenchmarkIteratorChecks() {
+  MeasureIteration<BiDirectionalList<int, CheckedIterators>>("checked iterators");
+  MeasureIteration<BiDirectionalList<int, UncheckedIterators>>("unchecked iterators");
+}
+
+void BenchmarkIndexedFind() {
+  MeasureFind<BiDirectionalList<int>>("plain list");
+  MeasureFind<IndexedBiDirectionalList<int>>("indexed list");
+
+  std::vector<int> values(kFindListSize);
+  std::iota(values.begin(), values.end(), 0);
+  IndexedBiDirectionalList<int> list(values);
+  std::cout << "  index memory usage: " << list.IndexMemoryUsage() / kFindListSize
+            << " bytes/element" << std::endl;
+}
+
+void BenchmarkPredicateAlgorithms() {
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+  BiDirectionalList<int> list(values);
+
+  // A capturing predicate which never matches, so the whole list is scanned
+  int limit = -1;
+  auto is_below_limit = [&limit](const int& x) { return x < limit; };
+
+  double erased = MeasureNanoseconds([&list, &is_below_limit] {
+    DoNotOptimize(list.Find(std::function<bool(const int&)>(is_below_limit)));
+  });
+  ReportNanosecondsPerOperation("Find(std::function)", erased, list.Size());
+
+  double inlined = MeasureNanoseconds([&list, &is_below_limit] {
+    DoNotOptimize(list.FindIf(is_below_limit));
+  });
+  ReportNanosecondsPerOperation("FindIf(lambda)", inlined, list.Size());
+
+  double counted = MeasureNanoseconds([&list, &is_below_limit] {
+    DoNotOptimize(list.CountIf(is_below_limit));
+  });
+  ReportNanosecondsPerOperation("CountIf(lambda)", counted, list.Size());
+
+  double removed = MeasureNanoseconds([&list] {
+    DoNotOptimize(list.RemoveIf([](const int& x) { return x % 2 == 0; }));
+  }, 1);
+  ReportNanosecondsPerOperation("RemoveIf(every second element)", removed, values.size());
+}
+
+void BenchmarkConcurrentList() {
+  int max_threads_count = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<int> threads_counts;
+  for (int threads_count = 1; threads_count < max_threads_count; threads_count *= 2) {
+    threads_counts.push_back(threads_count);
+  }
+  threads_counts.push_back(max_threads_count);
+
+  for (int threads_count : threads_counts) {
+    MeasureConcurrentThroughput<GlobalMutexWorkload>("global mutex list", threads_count);
+    MeasureConcurrentThroughput<ConcurrentListWorkload>("ConcurrentList", threads_count);
+  }
+}
+
+void BenchmarkCompactList() {
+  MeasureFootprint<BiDirectionalList<int>, int>("BiDirectionalList<int>", kLargeListSize);
+  MeasureFootprint<CompactList<int>, int>("CompactList<int>", kLargeListSize);
+  MeasureFootprint<BiDirectionalList<Point>, Point>("BiDirectionalList<Point>", kLargeListSize);
+  MeasureFootprint<CompactList<Point>, Point>("CompactList<Point>", kLargeListSize);
+}
+
+void BenchmarkPositionalAccess() {
+  std::vector<int> values(kPositionalListSize);
+  std::iota(values.begin(), values.end(), 0);
+  BiDirectionalList<int> list(values);
+  OrderStatisticsList<int> order_statistics_list(values);
+
+  std::mt19937 generator(2018);
+  std::uniform_int_distribution<size_t> index_distribution(0, kPositionalListSize - 1);
+  std::vector<size_t> indices(kPositionalQueriesCount);
+  for (size_t& index : indices) {
+    index = index_distribution(generator);
+  }
+
+  double walked = MeasureNanoseconds([&list, &indices] {
+    for (size_t index : indices) {
+      auto iterator = list.begin();
+      for (size_t i = 0; i < index; ++i) {
+        ++iterator;
+      }
+      DoNotOptimize(*iterator);
+    }
+  });
+  ReportNanosecondsPerOperation("BiDirectionalList walk to k-th", walked, indices.size());
+
+  double indexed = MeasureNanoseconds([&order_statistics_list, &indices] {
+    for (size_t index : indices) {
+      DoNotOptimize(order_statistics_list.At(index));
+    }
+  });
+  ReportNanosecondsPerOperation("OrderStatisticsList At(k)", indexed, indices.size());
+
+  double ranked = MeasureNanoseconds([&order_statistics_list, &indices] {
+    for (size_t index : indices) {
+      DoNotOptimize(order_statistics_list.IndexOf(order_statistics_list.IteratorAt(index)));
+    }
+  });
+  ReportNanosecondsPerOperation("OrderStatisticsList IteratorAt(k) + IndexOf", ranked, indices.size());
+
+  double inserted = MeasureNanoseconds([&order_statistics_list, &indices] {
+    for (size_t index : indices) {
+      order_statistics_list.InsertAt(index, 0);
+    }
+  }, 1);
+  ReportNanosecondsPerOperation("OrderStatisticsList InsertAt(k)", inserted, indices.size());
+}
+
+void BenchmarkBulkConstructionAndExport() {
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+
+  AllocationStats before = CurrentAllocationStats();
+  double pushed = MeasureNanoseconds([&values] {
+    BiDirectionalList<int> list;
+    for (int value : values) {
+      list.PushBack(value);
+    }
+    DoNotOptimize(list);
+  }, 1);
+  AllocationStats after = CurrentAllocationStats();
+  ReportNanosecondsPerOperation("PushBack one by one", pushed, values.size());
+  std::cout << "  " << after.allocations_count - before.allocations_count << " allocations" << std::endl;
+
+  before = CurrentAllocationStats();
+  double ranged = MeasureNanoseconds([&values] {
+    BiDirectionalList<int> list(values.begin(), values.end());
+    DoNotOptimize(list);
+  }, 1);
+  after = CurrentAllocationStats();
+  ReportNanosecondsPerOperation("range constructor", ranged, values.size());
+  std::cout << "  " << after.allocations_count - before.allocations_count << " allocations" << std::endl;
+
+  // Export of heavy values: copying export vs moving one
+  const size_t exported_count = kLargeListSize / 10;
+  std::vector<std::vector<int>> rows(exported_count, std::vector<int>(16));
+  double copied = MeasureNanoseconds([&rows] {
+    BiDirectionalList<std::vector<int>> list(rows);
+    DoNotOptimize(list.AsArray());
+  }, 1);
+  ReportNanosecondsPerOperation("construct + AsArray", copied, exported_count);
+
+  double drained = MeasureNanoseconds([&rows] {
+    BiDirectionalList<std::vector<int>> list(rows);
+    DoNotOptimize(list.DrainToVector());
+  }, 1);
+  ReportNanosecondsPerOperation("construct + DrainToVector", drained, exported_count);
+}
+
+void BenchmarkCompact() {
+  const size_t churn_operations_count = 2 * kLargeListSize;
+
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+  BiDirectionalList<int> list;
+  std::vector<BiDirectionalList<int>::Iterator> iterators;
+  iterators.reserve(kLargeListSize);
+  for (int value : values) {
+    list.PushBack(value);
+    iterators.push_back(--list.end());
+  }
+
+  auto measure_traversal = [&list](const std::string& name) {
+    double summed = MeasureNanoseconds([&list] {
+      long long sum = 0;
+      list.ForEach([&sum](int x) { sum += x; });
+      DoNotOptimize(sum);
+    });
+    ReportNanosecondsPerOperation(name + " ForEach", summed, list.Size());
+
+    double found = MeasureNanoseconds([&list] {
+      DoNotOptimize(list.Find(-1));
+    });
+    ReportNanosecondsPerOperation(name + " Find (miss)", found, list.Size());
+
+    double exported = MeasureNanoseconds([&list] {
+      DoNotOptimize(list.AsArray());
+    });
+    ReportNanosecondsPerOperation(name + " AsArray", exported, list.Size());
+  };
+
+  measure_traversal("fresh list");
+
+  // Erase a random element and insert a new one before another random
+  // element, so that list order no longer follows allocation order
+  std::mt19937 generator(2018);
+  std::uniform_int_distribution<size_t> index_distribution(0, kLargeListSize - 1);
+  for (size_t i = 0; i < churn_operations_count; ++i) {
+    size_t erased_index = index_distribution(generator);
+    size_t position_index = index_distribution(generator);
+    if (erased_index == position_index) {
+      continue;
+    }
+    list.Erase(iterators[erased_index]);
+    auto position = iterators[position_index];
+    list.InsertBefore(position, static_cast<int>(i));
+    iterators[erased_index] = --position;
+  }
+  measure_traversal("after churn");
+
+  double compacted = MeasureNanoseconds([&list] {
+    list.Compact();
+  }, 1);
+  ReportNanosecondsPerOperation("Compact", compacted, list.Size());
+  measure_traversal("after Compact");
+}
+
+void BenchmarkLruCache() {
+  const std::vector<int> keys = ZipfianKeys(kZipfKeysCount, 1.0, 1'000'000);
+
+  for (size_t capacity : {1'000u, 10'000u}) {
+    const std::string suffix = " (capacity " + std::to_string(capacity) + ")";
+
+    // The linear scan is too slow for the whole key sequence
+    std::vector<int> prefix(keys.begin(), keys.begin() + 20'000);
+    LinearLruCache linear_cache(capacity);
+    MeasureCache("list + linear Find" + suffix, linear_cache, prefix);
+
+    LruCache<int, int> cache(capacity);
+    MeasureCache("LruCache" + suffix, cache, keys);
+    std::cout << "  evictions: " << cache.Stats().evictions_count << std::endl;
+  }
+}
+
+void BenchmarkCopyAndMove() {
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+  const BiDirectionalList<int> source(values);
+
+  double pushed = MeasureNanoseconds([&source] {
+    BiDirectionalList<int> copy;
+    source.ForEach([&copy](int x) { copy.PushBack(x); });
+    DoNotOptimize(copy);
+  });
+  ReportNanosecondsPerOperation("copy by PushBack", pushed, source.Size());
+
+  AllocationStats before = CurrentAllocationStats();
+  double copied = MeasureNanoseconds([&source] {
+    BiDirectionalList<int> copy(source);
+    DoNotOptimize(copy);
+  }, 1);
+  AllocationStats after = CurrentAllocationStats();
+  ReportNanosecondsPerOperation("copy constructor", copied, source.Size());
+  std::cout << "  " << after.allocations_count - before.allocations_count << " allocations" << std::endl;
+
+  BiDirectionalList<int> target(source);
+  before = CurrentAllocationStats();
+  double assigned = MeasureNanoseconds([&source, &target] {
+    target = source;
+  });
+  after = CurrentAllocationStats();
+  ReportNanosecondsPerOperation("copy assignment to an equally long list", assigned, source.Size());
+  std::cout << "  " << after.allocations_count - before.allocations_count << " allocations" << std::endl;
+
+  double moved = MeasureNanoseconds([&target] {
+    BiDirectionalList<int> other(std::move(target));
+    target = std::move(other);
+  });
+  std::cout << "  move construction + move assignment: " << moved << " ns" << std::endl;
+}
+
+void BenchmarkEraseRange() {
+  std::vector<int> values(kLargeListSize);
+  std::iota(values.begin(), values.end(), 0);
+
+  // Build the lists out of the measured region, then erase all but the edges
+  double one_by_one = 0;
+  {
+    BiDirectionalList<int> list(values);
+    auto first = ++list.begin();
+    auto last = --list.end();
+    one_by_one = MeasureNanoseconds([&list, &first, &last] {
+      while (first != last) {
+        auto next = first;
+        ++next;
+        list.Erase(first);
+        first = next;
+      }
+    }, 1);
+  }
+  ReportNanosecondsPerOperation("Erase(iterator) in a loop", one_by_one, values.size() - 2);
+
+  double spliced = 0;
+  {
+    BiDirectionalList<int> list(values);
+    spliced = MeasureNanoseconds([&list] {
+      list.Erase(++list.begin(), --list.end());
+    }, 1);
+  }
+  ReportNanosecondsPerOperation("Erase(first, last)", spliced, values.size() - 2);
+
+  double dropped = 0;
+  {
+    BiDirectionalList<int> list(values);
+    dropped = MeasureNanoseconds([&list] {
+      list.DropFront(list.Size() / 2);
+      list.Truncate(list.Size() / 2);
+    }, 1);
+  }
+  ReportNanosecondsPerOperation("DropFront(n / 2) + Truncate(n / 4)", dropped, 3 * values.size() / 4);
+}
+
+void BenchmarkParallelAlgorithms() {
+  const size_t list_size = 4 * kLargeListSize;
+  std::vector<double> values(list_size);
+  std::iota(values.begin(), values.end(), 0.0);
+  BiDirectionalList<double> list(values.begin(), values.end());
+
+  // Enough work per element to outweigh the pointer chasing
+  auto transform = [](double& x) {
+    for (int i = 0; i < 8; ++i) {
+      x = std::sqrt(x + 1.0);
+    }
+  };
+  auto accumulate = [](double partial, double x) { return partial + std::sqrt(x); };
+
+  double sequential = MeasureNanoseconds([&list, &transform] {
+    list.ForEach(transform);
+  }, 1);
+  ReportNanosecondsPerOperation("ForEach", sequential, list_size);
+
+  int max_threads_count = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<int> threads_counts;
+  for (int threads_count = 1; threads_count < max_threads_count; threads_count *= 2) {
+    threads_counts.push_back(threads_count);
+  }
+  threads_counts.push_back(max_threads_count);
+
+  for (int threads_count : threads_counts) {
+    const std::string suffix = " (" + std::to_string(threads_count) + " threads)";
+    double parallel = MeasureNanoseconds([&list, &transform, threads_count] {
+      list.ParallelForEach(transform, threads_count);
+    }, 1);
+    ReportNanosecondsPerOperation("ParallelForEach" + suffix, parallel, list_size);
+
+    double reduced = MeasureNanoseconds([&list, &accumulate, threads_count] {
+      DoNotOptimize(list.ParallelReduce(0.0, accumulate, std::plus<double>(), threads_count));
+    }, 1);
+    ReportNanosecondsPerOperation("ParallelReduce" + suffix, reduced, list_size);
+  }
+}
@@ -0,0 +1,21 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_BENCHMARKS_H
+#define BIDIRECTIONALLIST_BENCHMARKS_H
+
+void BenchmarkIteratorChecks();
+void BenchmarkIndexedFind();
+void BenchmarkPredicateAlgorithms();
+void BenchmarkConcurrentList();
+void BenchmarkCompactList();
+void BenchmarkPositionalAccess();
+void BenchmarkBulkConstructionAndExport();
+void BenchmarkCompact();
+void BenchmarkLruCache();
+void BenchmarkCopyAndMove();
+void BenchmarkEraseRange();
+void BenchmarkParallelAlgorithms();
+
+#endif //BIDIRECTIONALLIST_BENCHMARKS_H
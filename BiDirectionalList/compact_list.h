@@ -0,0 +1,654 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_COMPACT_LIST_H
+#define BIDIRECTIONALLIST_COMPACT_LIST_H
+
+// Compact variant of BiDirectionalList: nodes live in one contiguous array
+// and are linked by 32-bit indices instead of pointers, which takes 8 bytes
+// of links per element instead of 16 and saves the per-node allocation.
+// Erased slots are chained into a free list and reused in O(1). A value is
+// destroyed when its element is erased, and a free slot holds only raw
+// storage, so T needs neither a default constructor nor assignment.
+//
+// Iterators keep indices, so unlike pointers they stay valid when the node
+// array grows: only iterators to erased elements are invalidated, exactly
+// as in BiDirectionalList. The list holds at most 2^32 - 2 elements.
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <utility>
+
+template<typename T>
+class CompactList {
+ protected:
+  struct Node;
+
+ public:
+  class Iterator : public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    Iterator(const Iterator& other) = default;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    Iterator& operator++();
+    const Iterator operator++(int);
+
+    Iterator& operator--();
+    const Iterator operator--(int);
+
+    Iterator& operator=(const Iterator& other);
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class CompactList;
+
+    CompactList* const list_;
+    uint32_t index_;
+
+    Iterator(CompactList* const list, uint32_t index)
+        : list_(list), index_(index) {}
+  };
+
+  class ConstIterator :
+      public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    ConstIterator(const ConstIterator& other) = default;
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    ConstIterator& operator++();
+    const ConstIterator operator++(int);
+
+    ConstIterator& operator--();
+    const ConstIterator operator--(int);
+
+    ConstIterator& operator=(const ConstIterator& other);
+    bool operator==(const ConstIterator& other) const;
+    bool operator!=(const ConstIterator& other) const;
+
+   private:
+    friend class CompactList;
+
+    const CompactList* const list_;
+    uint32_t index_;
+
+    ConstIterator(const CompactList* const list, uint32_t index)
+        : list_(list), index_(index) {}
+  };
+
+  CompactList();
+
+  template<typename Container>
+  explicit CompactList(const Container&);
+
+  CompactList(const CompactList&) = delete;
+  CompactList& operator=(const CompactList&) = delete;
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  void Clear();
+
+  // Preallocates slots for 'capacity' elements
+  void Reserve(size_t capacity);
+
+  // Bytes taken by the node array, including free and reserved slots
+  size_t MemoryUsage() const;
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  std::vector<T> AsArray() const;
+
+  void InsertBefore(Iterator position, const T& value);
+  void InsertBefore(Iterator position, T&& value);
+
+  void InsertAfter(Iterator position, const T& value);
+  void InsertAfter(Iterator position, T&& value);
+
+  void PushBack(const T& value);
+  void PushBack(T&& value);
+
+  void PushFront(const T& value);
+  void PushFront(T&& value);
+
+  void Erase(Iterator position);
+
+  void PopFront();
+  void PopBack();
+
+  T Front() const;
+  T Back() const;
+
+  Iterator Find(const T& value);
+  ConstIterator Find(const T& value) const;
+
+  Iterator Find(std::function<bool(const T&)> predicate);
+  ConstIterator Find(std::function<bool(const T&)> predicate) const;
+
+ protected:
+  static const uint32_t kNullIndex = UINT32_MAX;
+  // previous_node_ of a free slot; never a valid index, as the list holds
+  // fewer than kNullIndex - 1 slots
+  static const uint32_t kFreeSlot = UINT32_MAX - 1;
+
+  // The value is alive only while the slot is not free. Copying and moving
+  // a node, which the array does when it grows, relocates a live value.
+  struct Node {
+    template<typename U>
+    explicit Node(U&& value);
+    Node(const Node& other);
+    Node(Node&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+    ~Node();
+
+    Node& operator=(const Node&) = delete;
+
+    T& Value();
+    const T& Value() const;
+    bool IsFree() const;
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type value_;
+    uint32_t next_node_;
+    uint32_t previous_node_;
+  };
+
+  std::vector<Node> nodes_;
+
+  size_t size_;
+
+  uint32_t first_;
+  uint32_t last_;
+  // Head of the chain of erased slots, linked through next_node_
+  uint32_t free_;
+
+  template<typename U>
+  uint32_t Allocate(U&& value);
+
+  void InsertBefore(uint32_t existing_node, uint32_t new_node);
+  void Erase(uint32_t node);
+};
+
+template<typename T>
+const uint32_t CompactList<T>::kNullIndex;
+
+template<typename T>
+const uint32_t CompactList<T>::kFreeSlot;
+
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+template<typename T>
+T& CompactList<T>::Iterator::operator*() const {
+  if (index_ == kNullIndex) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return list_->nodes_[index_].Value();
+}
+
+template<typename T>
+T* CompactList<T>::Iterator::operator->() const {
+  if (index_ == kNullIndex) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(list_->nodes_[index_].Value());
+}
+
+template<typename T>
+typename CompactList<T>::Iterator& CompactList<T>::Iterator::operator++() {
+  if (index_ == kNullIndex) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  index_ = list_->nodes_[index_].next_node_;
+  return *this;
+}
+
+template<typename T>
+const typename CompactList<T>::Iterator CompactList<T>::Iterator::operator++(int) {
+  Iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T>
+typename CompactList<T>::Iterator& CompactList<T>::Iterator::operator--() {
+  if (index_ == list_->first_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  index_ = (index_ != kNullIndex) ? list_->nodes_[index_].previous_node_ : list_->last_;
+  return *this;
+}
+
+template<typename T>
+const typename CompactList<T>::Iterator CompactList<T>::Iterator::operator--(int) {
+  Iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T>
+typename CompactList<T>::Iterator& CompactList<T>::Iterator::operator=(const CompactList::Iterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  index_ = other.index_;
+  return *this;
+}
+
+template<typename T>
+bool CompactList<T>::Iterator::operator==(const CompactList::Iterator& other) const {
+  return index_ == other.index_;
+}
+
+template<typename T>
+bool CompactList<T>::Iterator::operator!=(const CompactList::Iterator& other) const {
+  return index_ != other.index_;
+}
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+
+
+
+
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+template<typename T>
+const T& CompactList<T>::ConstIterator::operator*() const {
+  if (index_ == kNullIndex) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return list_->nodes_[index_].Value();
+}
+
+template<typename T>
+const T* CompactList<T>::ConstIterator::operator->() const {
+  if (index_ == kNullIndex) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(list_->nodes_[index_].Value());
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator& CompactList<T>::ConstIterator::operator++() {
+  if (index_ == kNullIndex) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  index_ = list_->nodes_[index_].next_node_;
+  return *this;
+}
+
+template<typename T>
+const typename CompactList<T>::ConstIterator CompactList<T>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator& CompactList<T>::ConstIterator::operator--() {
+  if (index_ == list_->first_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  index_ = (index_ != kNullIndex) ? list_->nodes_[index_].previous_node_ : list_->last_;
+  return *this;
+}
+
+template<typename T>
+const typename CompactList<T>::ConstIterator CompactList<T>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator& CompactList<T>::ConstIterator::operator=(const CompactList::ConstIterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  index_ = other.index_;
+  return *this;
+}
+
+template<typename T>
+bool CompactList<T>::ConstIterator::operator==(const CompactList::ConstIterator& other) const {
+  return index_ == other.index_;
+}
+
+template<typename T>
+bool CompactList<T>::ConstIterator::operator!=(const CompactList::ConstIterator& other) const {
+  return index_ != other.index_;
+}
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+template<typename T>
+template<typename U>
+CompactList<T>::Node::Node(U&& value) : next_node_(kNullIndex),
+                                        previous_node_(kNullIndex) {
+  new (&value_) T(std::forward<U>(value));
+}
+
+template<typename T>
+CompactList<T>::Node::Node(const CompactList::Node& other) : next_node_(other.next_node_),
+                                                            previous_node_(other.previous_node_) {
+  if (!other.IsFree()) {
+    new (&value_) T(other.Value());
+  }
+}
+
+template<typename T>
+CompactList<T>::Node::Node(CompactList::Node&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : next_node_(other.next_node_),
+      previous_node_(other.previous_node_) {
+  if (!other.IsFree()) {
+    new (&value_) T(std::move(other.Value()));
+  }
+}
+
+template<typename T>
+CompactList<T>::Node::~Node() {
+  if (!IsFree()) {
+    Value().~T();
+  }
+}
+
+template<typename T>
+T& CompactList<T>::Node::Value() {
+  return *reinterpret_cast<T*>(&value_);
+}
+
+template<typename T>
+const T& CompactList<T>::Node::Value() const {
+  return *reinterpret_cast<const T*>(&value_);
+}
+
+template<typename T>
+bool CompactList<T>::Node::IsFree() const {
+  return previous_node_ == kFreeSlot;
+}
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- CompactList methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T>
+CompactList<T>::CompactList() : size_(0), first_(kNullIndex), last_(kNullIndex), free_(kNullIndex) {}
+
+template<typename T>
+template<typename Container>
+CompactList<T>::CompactList(const Container& container) : CompactList() {
+  Reserve(container.size());
+  for (const T& item : container) {
+    PushBack(item);
+  }
+}
+
+template<typename T>
+bool CompactList<T>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template<typename T>
+size_t CompactList<T>::Size() const {
+  return size_;
+}
+
+template<typename T>
+void CompactList<T>::Clear() {
+  nodes_.clear();
+  size_ = 0;
+  first_ = last_ = free_ = kNullIndex;
+}
+
+template<typename T>
+void CompactList<T>::Reserve(size_t capacity) {
+  if (capacity >= kNullIndex) {
+    throw std::length_error("CompactList can't hold that many elements");
+  }
+  nodes_.reserve(capacity);
+}
+
+template<typename T>
+size_t CompactList<T>::MemoryUsage() const {
+  return nodes_.capacity() * sizeof(Node);
+}
+
+template<typename T>
+typename CompactList<T>::Iterator CompactList<T>::begin() {
+  return {this, first_};
+}
+
+template<typename T>
+typename CompactList<T>::Iterator CompactList<T>::end() {
+  return {this, kNullIndex};
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator CompactList<T>::begin() const {
+  return {this, first_};
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator CompactList<T>::end() const {
+  return {this, kNullIndex};
+}
+
+template<typename T>
+std::vector<T> CompactList<T>::AsArray() const {
+  std::vector<T> array;
+  array.reserve(size_);
+  for (uint32_t node = first_; node != kNullIndex; node = nodes_[node].next_node_) {
+    array.push_back(nodes_[node].Value());
+  }
+  return array;
+}
+
+template<typename T>
+void CompactList<T>::InsertBefore(CompactList::Iterator position, const T& value) {
+  InsertBefore(position.index_, Allocate(value));
+}
+
+template<typename T>
+void CompactList<T>::InsertBefore(CompactList::Iterator position, T&& value) {
+  InsertBefore(position.index_, Allocate(std::move(value)));
+}
+
+template<typename T>
+void CompactList<T>::InsertAfter(CompactList::Iterator position, const T& value) {
+  uint32_t next = (position.index_ != kNullIndex) ? nodes_[position.index_].next_node_ : kNullIndex;
+  InsertBefore(next, Allocate(value));
+}
+
+template<typename T>
+void CompactList<T>::InsertAfter(CompactList::Iterator position, T&& value) {
+  uint32_t next = (position.index_ != kNullIndex) ? nodes_[position.index_].next_node_ : kNullIndex;
+  InsertBefore(next, Allocate(std::move(value)));
+}
+
+template<typename T>
+void CompactList<T>::PushBack(const T& value) {
+  InsertBefore(kNullIndex, Allocate(value));
+}
+
+template<typename T>
+void CompactList<T>::PushBack(T&& value) {
+  InsertBefore(kNullIndex, Allocate(std::move(value)));
+}
+
+template<typename T>
+void CompactList<T>::PushFront(const T& value) {
+  InsertBefore(first_, Allocate(value));
+}
+
+template<typename T>
+void CompactList<T>::PushFront(T&& value) {
+  InsertBefore(first_, Allocate(std::move(value)));
+}
+
+template<typename T>
+void CompactList<T>::Erase(CompactList::Iterator position) {
+  if (position.index_ == kNullIndex) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  Erase(position.index_);
+}
+
+template<typename T>
+void CompactList<T>::PopFront() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop front element from empty list");
+  }
+  Erase(first_);
+}
+
+template<typename T>
+void CompactList<T>::PopBack() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop back element from empty list");
+  }
+  Erase(last_);
+}
+
+template<typename T>
+T CompactList<T>::Front() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access front element in empty list");
+  }
+  return nodes_[first_].Value();
+}
+
+template<typename T>
+T CompactList<T>::Back() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access back element in empty list");
+  }
+  return nodes_[last_].Value();
+}
+
+template<typename T>
+typename CompactList<T>::Iterator CompactList<T>::Find(const T& value) {
+  uint32_t node = first_;
+  while (node != kNullIndex && !(nodes_[node].Value() == value)) {
+    node = nodes_[node].next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator CompactList<T>::Find(const T& value) const {
+  uint32_t node = first_;
+  while (node != kNullIndex && !(nodes_[node].Value() == value)) {
+    node = nodes_[node].next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T>
+typename CompactList<T>::Iterator CompactList<T>::Find(std::function<bool(const T&)> predicate) {
+  uint32_t node = first_;
+  while (node != kNullIndex && !predicate(nodes_[node].Value())) {
+    node = nodes_[node].next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T>
+typename CompactList<T>::ConstIterator CompactList<T>::Find(std::function<bool(const T&)> predicate) const {
+  uint32_t node = first_;
+  while (node != kNullIndex && !predicate(nodes_[node].Value())) {
+    node = nodes_[node].next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T>
+template<typename U>
+uint32_t CompactList<T>::Allocate(U&& value) {
+  if (free_ != kNullIndex) {
+    uint32_t node = free_;
+    // The slot leaves the free list only once the value is constructed
+    new (&nodes_[node].Value()) T(std::forward<U>(value));
+    free_ = nodes_[node].next_node_;
+    nodes_[node].previous_node_ = kNullIndex;
+    return node;
+  }
+  if (nodes_.size() + 1 >= kNullIndex) {
+    throw std::length_error("CompactList can't hold that many elements");
+  }
+  nodes_.emplace_back(std::forward<U>(value));
+  return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+template<typename T>
+void CompactList<T>::InsertBefore(uint32_t existing_node, uint32_t new_node) {
+  Node& node = nodes_[new_node];
+  node.next_node_ = existing_node;
+  if (existing_node != kNullIndex) {
+    node.previous_node_ = nodes_[existing_node].previous_node_;
+    nodes_[existing_node].previous_node_ = new_node;
+  } else {
+    node.previous_node_ = last_;
+    last_ = new_node;
+  }
+  if (node.previous_node_ != kNullIndex) {
+    nodes_[node.previous_node_].next_node_ = new_node;
+  } else {
+    first_ = new_node;
+  }
+  ++size_;
+}
+
+template<typename T>
+void CompactList<T>::Erase(uint32_t node) {
+  Node& erased = nodes_[node];
+  if (erased.previous_node_ != kNullIndex) {
+    nodes_[erased.previous_node_].next_node_ = erased.next_node_;
+  } else {
+    first_ = erased.next_node_;
+  }
+  if (erased.next_node_ != kNullIndex) {
+    nodes_[erased.next_node_].previous_node_ = erased.previous_node_;
+  } else {
+    last_ = erased.previous_node_;
+  }
+
+  // The slot itself stays in the array
+  erased.Value().~T();
+  erased.previous_node_ = kFreeSlot;
+  erased.next_node_ = free_;
+  free_ = node;
+  --size_;
+}
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- CompactList methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_COMPACT_LIST_H
@@ -0,0 +1,417 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_CONCURRENT_LIST_H
+#define BIDIRECTIONALLIST_CONCURRENT_LIST_H
+
+// Thread-safe variant of BiDirectionalList with a mutex per node.
+//
+// Operations lock only the nodes they relink: InsertAfter locks the position
+// and its successor, InsertBefore its predecessor and the position, Erase the
+// predecessor, the node and the successor. Nodes are always locked from
+// left to right, so operations on different regions of the list run in
+// parallel and never deadlock. FindIf, ForEach and AsArray traverse the list
+// hand-over-hand, holding at most two node locks at a time.
+//
+// Erased nodes are reclaimed through EpochDomain. An Iterator stays
+// dereferenceable while the thread holds the Guard it was obtained under,
+// or for as long as its element is not erased. Operations which take an
+// Iterator take the caller's Guard too, so the node it points to cannot be
+// reclaimed under them even if another thread erases it. Values are
+// immutable once inserted, iterators only give const access to them.
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "epoch_domain.h"
+
+template<typename T>
+class ConcurrentList {
+ protected:
+  struct NodeBase;
+  struct Node;
+
+ public:
+  using Guard = EpochGuard;
+
+  class Iterator {
+   public:
+    Iterator(const Iterator& other) = default;
+    Iterator& operator=(const Iterator& other) = default;
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class ConcurrentList;
+
+    Node* node_;
+
+    explicit Iterator(Node* node) : node_(node) {}
+  };
+
+  ConcurrentList();
+
+  template<typename Container>
+  explicit ConcurrentList(const Container&);
+
+  ConcurrentList(const ConcurrentList&) = delete;
+  ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+  // Must not run concurrently with any other operation on the list
+  ~ConcurrentList();
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  Iterator end() const;
+
+  // Consistent snapshot taken hand-over-hand
+  std::vector<T> AsArray() const;
+
+  Iterator PushBack(const Guard& guard, const T& value);
+  Iterator PushFront(const Guard& guard, const T& value);
+  void PushBack(const T& value);
+  void PushFront(const T& value);
+
+  // Throw std::invalid_argument if 'position' is end() or already erased
+  Iterator InsertBefore(const Guard& guard, Iterator position, const T& value);
+  Iterator InsertAfter(const Guard& guard, Iterator position, const T& value);
+
+  // Returns false if the element was already erased by another thread
+  bool Erase(const Guard& guard, Iterator position);
+
+  bool TryPopFront(T* value);
+  bool TryPopBack(T* value);
+
+  template<typename Predicate>
+  Iterator FindIf(const Guard& guard, Predicate predicate) const;
+
+  template<typename Function>
+  void ForEach(Function function) const;
+
+ protected:
+  struct NodeBase {
+    NodeBase() : next_node_(nullptr), previous_node_(nullptr), erased_(false) {}
+
+    std::mutex mutex_;
+    std::atomic<NodeBase*> next_node_;
+    std::atomic<NodeBase*> previous_node_;
+    std::atomic<bool> erased_;
+  };
+
+  struct Node : NodeBase {
+    explicit Node(const T& value) : value_(value) {}
+
+    const T value_;
+  };
+
+  // Sentinels, never erased
+  NodeBase head_;
+  NodeBase tail_;
+
+  std::atomic<size_t> size_;
+
+  static void DeleteNode(void* node);
+
+  // Links a new node between 'previous' and 'next'. Both must be locked
+  // by the caller and be adjacent.
+  Node* Link(NodeBase* previous, NodeBase* next, const T& value);
+
+  // Locks and returns the live predecessor of 'node', which must be pinned.
+  // Returns nullptr if 'node' is erased.
+  NodeBase* LockPrevious(NodeBase* node);
+
+  Iterator InsertBefore(NodeBase* node, const T& value);
+  Iterator InsertAfter(NodeBase* node, const T& value);
+  bool Erase(Node* node, T* value);
+};
+
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+template<typename T>
+const T& ConcurrentList<T>::Iterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->value_;
+}
+
+template<typename T>
+const T* ConcurrentList<T>::Iterator::operator->() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(node_->value_);
+}
+
+template<typename T>
+bool ConcurrentList<T>::Iterator::operator==(const ConcurrentList::Iterator& other) const {
+  return node_ == other.node_;
+}
+
+template<typename T>
+bool ConcurrentList<T>::Iterator::operator!=(const ConcurrentList::Iterator& other) const {
+  return node_ != other.node_;
+}
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------------------------|
+// |-------------------------------- ConcurrentList methods declaration -------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T>
+ConcurrentList<T>::ConcurrentList() : size_(0) {
+  head_.next_node_ = &tail_;
+  tail_.previous_node_ = &head_;
+}
+
+template<typename T>
+template<typename Container>
+ConcurrentList<T>::ConcurrentList(const Container& container) : ConcurrentList() {
+  for (const T& item : container) {
+    PushBack(item);
+  }
+}
+
+template<typename T>
+ConcurrentList<T>::~ConcurrentList() {
+  NodeBase* node = head_.next_node_;
+  while (node != &tail_) {
+    NodeBase* next_node = node->next_node_;
+    delete static_cast<Node*>(node);
+    node = next_node;
+  }
+}
+
+template<typename T>
+bool ConcurrentList<T>::IsEmpty() const {
+  return Size() == 0;
+}
+
+template<typename T>
+size_t ConcurrentList<T>::Size() const {
+  return size_.load();
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::end() const {
+  return Iterator(nullptr);
+}
+
+template<typename T>
+std::vector<T> ConcurrentList<T>::AsArray() const {
+  std::vector<T> array;
+  array.reserve(Size());
+  ForEach([&array](const T& value) {
+    array.push_back(value);
+  });
+  return array;
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::PushBack(const Guard&, const T& value) {
+  return InsertBefore(&tail_, value);
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::PushFront(const Guard&, const T& value) {
+  return InsertAfter(&head_, value);
+}
+
+template<typename T>
+void ConcurrentList<T>::PushBack(const T& value) {
+  Guard guard;
+  InsertBefore(&tail_, value);
+}
+
+template<typename T>
+void ConcurrentList<T>::PushFront(const T& value) {
+  Guard guard;
+  InsertAfter(&head_, value);
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::InsertBefore(const Guard&, ConcurrentList::Iterator position, const T& value) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to insert relative to end()");
+  }
+  return InsertBefore(position.node_, value);
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::InsertAfter(const Guard&, ConcurrentList::Iterator position, const T& value) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to insert relative to end()");
+  }
+  return InsertAfter(position.node_, value);
+}
+
+template<typename T>
+bool ConcurrentList<T>::Erase(const Guard&, ConcurrentList::Iterator position) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  return Erase(position.node_, nullptr);
+}
+
+template<typename T>
+bool ConcurrentList<T>::TryPopFront(T* value) {
+  Guard guard;
+  while (true) {
+    NodeBase* first = head_.next_node_;
+    if (first == &tail_) {
+      return false;
+    }
+    if (Erase(static_cast<Node*>(first), value)) {
+      return true;
+    }
+  }
+}
+
+template<typename T>
+bool ConcurrentList<T>::TryPopBack(T* value) {
+  Guard guard;
+  while (true) {
+    NodeBase* last = tail_.previous_node_;
+    if (last == &head_) {
+      return false;
+    }
+    if (Erase(static_cast<Node*>(last), value)) {
+      return true;
+    }
+  }
+}
+
+template<typename T>
+template<typename Predicate>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::FindIf(const Guard&, Predicate predicate) const {
+  NodeBase* previous = const_cast<NodeBase*>(&head_);
+  previous->mutex_.lock();
+  NodeBase* node = previous->next_node_;
+  while (node != &tail_) {
+    node->mutex_.lock();
+    previous->mutex_.unlock();
+    if (predicate(static_cast<Node*>(node)->value_)) {
+      node->mutex_.unlock();
+      return Iterator(static_cast<Node*>(node));
+    }
+    previous = node;
+    node = node->next_node_;
+  }
+  previous->mutex_.unlock();
+  return end();
+}
+
+template<typename T>
+template<typename Function>
+void ConcurrentList<T>::ForEach(Function function) const {
+  NodeBase* previous = const_cast<NodeBase*>(&head_);
+  previous->mutex_.lock();
+  NodeBase* node = previous->next_node_;
+  while (node != &tail_) {
+    node->mutex_.lock();
+    previous->mutex_.unlock();
+    function(static_cast<Node*>(node)->value_);
+    previous = node;
+    node = node->next_node_;
+  }
+  previous->mutex_.unlock();
+}
+
+template<typename T>
+void ConcurrentList<T>::DeleteNode(void* node) {
+  delete static_cast<Node*>(node);
+}
+
+template<typename T>
+typename ConcurrentList<T>::Node* ConcurrentList<T>::Link(NodeBase* previous, NodeBase* next, const T& value) {
+  Node* node = new Node(value);
+  node->previous_node_ = previous;
+  node->next_node_ = next;
+  previous->next_node_ = node;
+  next->previous_node_ = node;
+  ++size_;
+  return node;
+}
+
+template<typename T>
+typename ConcurrentList<T>::NodeBase* ConcurrentList<T>::LockPrevious(NodeBase* node) {
+  while (!node->erased_) {
+    NodeBase* previous = node->previous_node_;
+    previous->mutex_.lock();
+    // previous->next_node_ and previous->erased_ change only under
+    // previous->mutex_, so if it is live and still points to 'node',
+    // the two stay adjacent until we unlock
+    if (!previous->erased_ && previous->next_node_ == node) {
+      return previous;
+    }
+    previous->mutex_.unlock();
+  }
+  return nullptr;
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::InsertBefore(NodeBase* node, const T& value) {
+  NodeBase* previous = LockPrevious(node);
+  if (previous == nullptr) {
+    throw std::invalid_argument("trying to insert relative to an erased element");
+  }
+  std::lock_guard<std::mutex> previous_lock(previous->mutex_, std::adopt_lock);
+  std::lock_guard<std::mutex> node_lock(node->mutex_);
+  return Iterator(Link(previous, node, value));
+}
+
+template<typename T>
+typename ConcurrentList<T>::Iterator ConcurrentList<T>::InsertAfter(NodeBase* node, const T& value) {
+  std::lock_guard<std::mutex> node_lock(node->mutex_);
+  if (node->erased_) {
+    throw std::invalid_argument("trying to insert relative to an erased element");
+  }
+  NodeBase* next = node->next_node_;
+  std::lock_guard<std::mutex> next_lock(next->mutex_);
+  return Iterator(Link(node, next, value));
+}
+
+template<typename T>
+bool ConcurrentList<T>::Erase(Node* node, T* value) {
+  NodeBase* previous = LockPrevious(node);
+  if (previous == nullptr) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> previous_lock(previous->mutex_, std::adopt_lock);
+    std::lock_guard<std::mutex> node_lock(node->mutex_);
+    NodeBase* next = node->next_node_;
+    std::lock_guard<std::mutex> next_lock(next->mutex_);
+
+    if (value != nullptr) {
+      *value = node->value_;
+    }
+    node->erased_ = true;
+    previous->next_node_ = next;
+    next->previous_node_ = previous;
+    --size_;
+  }
+  EpochDomain::Instance().Retire(node, &DeleteNode);
+  return true;
+}
+// |---------------------------------------------------------------------------------------------------|
+// |-------------------------------- ConcurrentList methods declaration -------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_CONCURRENT_LIST_H
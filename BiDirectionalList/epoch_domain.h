@@ -0,0 +1,192 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_EPOCH_DOMAIN_H
+#define BIDIRECTIONALLIST_EPOCH_DOMAIN_H
+
+// Epoch-based memory reclamation shared by the concurrent containers.
+//
+// A thread pins the current global epoch (EpochGuard) before it reads shared
+// nodes. An unlinked node is retired with the epoch it was retired in and is
+// freed only when the global epoch has moved two steps further: by then every
+// thread which could have seen the node has unpinned.
+//
+// Every thread using the domain registers its record on first use and
+// unregisters it on exit, so there is no limit on the number of threads.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class EpochDomain {
+ public:
+  static EpochDomain& Instance();
+
+  EpochDomain(const EpochDomain&) = delete;
+  EpochDomain& operator=(const EpochDomain&) = delete;
+
+  ~EpochDomain();
+
+  // Pins/unpins the calling thread, nested calls are allowed
+  void Enter();
+  void Exit();
+
+  // Schedules deleter(pointer) to run once no pinned thread can reach pointer
+  void Retire(void* pointer, void (*deleter)(void*));
+
+  // Number of retired objects which are not freed yet,
+  // objects buffered by other threads are not counted
+  size_t PendingCount();
+
+ private:
+  static const size_t kCollectThreshold = 64;
+  static const uint64_t kNotPinned = UINT64_MAX;
+
+  struct RetiredObject {
+    void* pointer;
+    void (*deleter)(void*);
+    uint64_t epoch;
+  };
+
+  // Retired objects are buffered per thread and handed over to the shared
+  // list in batches, so that Retire rarely touches the shared mutex
+  struct ThreadRecord {
+    ~ThreadRecord();
+
+    // Written only by the owning thread, read by TryAdvance of any thread
+    std::atomic<uint64_t> epoch{kNotPinned};
+    bool registered = false;
+    size_t nesting = 0;
+    std::vector<RetiredObject> retired;
+  };
+
+  EpochDomain() : global_epoch_(0) {}
+
+  ThreadRecord& CurrentThread();
+  void Flush(ThreadRecord* record);
+  bool TryAdvance();
+  void Collect();
+
+  std::atomic<uint64_t> global_epoch_;
+
+  // Locked after retired_mutex_ when both are needed
+  std::mutex threads_mutex_;
+  std::vector<ThreadRecord*> threads_;
+
+  std::mutex retired_mutex_;
+  std::vector<RetiredObject> retired_;
+};
+
+class EpochGuard {
+ public:
+  EpochGuard() { EpochDomain::Instance().Enter(); }
+  ~EpochGuard() { EpochDomain::Instance().Exit(); }
+
+  EpochGuard(const EpochGuard&) = delete;
+  EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- EpochDomain methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+inline EpochDomain& EpochDomain::Instance() {
+  static EpochDomain domain;
+  return domain;
+}
+
+inline EpochDomain::~EpochDomain() {
+  for (const RetiredObject& object : retired_) {
+    object.deleter(object.pointer);
+  }
+}
+
+inline EpochDomain::ThreadRecord::~ThreadRecord() {
+  if (registered) {
+    EpochDomain& domain = EpochDomain::Instance();
+    domain.Flush(this);
+    std::lock_guard<std::mutex> lock(domain.threads_mutex_);
+    std::vector<ThreadRecord*>& threads = domain.threads_;
+    threads.erase(std::find(threads.begin(), threads.end(), this));
+  }
+}
+
+inline EpochDomain::ThreadRecord& EpochDomain::CurrentThread() {
+  static thread_local ThreadRecord record;
+  if (!record.registered) {
+    std::lock_guard<std::mutex> lock(threads_mutex_);
+    threads_.push_back(&record);
+    record.registered = true;
+  }
+  return record;
+}
+
+inline void EpochDomain::Enter() {
+  ThreadRecord& record = CurrentThread();
+  if (record.nesting++ == 0) {
+    record.epoch.store(global_epoch_.load());
+  }
+}
+
+inline void EpochDomain::Exit() {
+  ThreadRecord& record = CurrentThread();
+  if (--record.nesting == 0) {
+    record.epoch.store(kNotPinned);
+  }
+}
+
+inline void EpochDomain::Retire(void* pointer, void (*deleter)(void*)) {
+  ThreadRecord& record = CurrentThread();
+  record.retired.push_back({pointer, deleter, global_epoch_.load()});
+  if (record.retired.size() >= kCollectThreshold) {
+    Flush(&record);
+  }
+}
+
+inline size_t EpochDomain::PendingCount() {
+  ThreadRecord& record = CurrentThread();
+  Flush(&record);
+  std::lock_guard<std::mutex> lock(retired_mutex_);
+  return retired_.size();
+}
+
+inline void EpochDomain::Flush(ThreadRecord* record) {
+  std::lock_guard<std::mutex> lock(retired_mutex_);
+  retired_.insert(retired_.end(), record->retired.begin(), record->retired.end());
+  record->retired.clear();
+  TryAdvance();
+  Collect();
+}
+
+inline bool EpochDomain::TryAdvance() {
+  uint64_t epoch = global_epoch_.load();
+  std::lock_guard<std::mutex> lock(threads_mutex_);
+  for (const ThreadRecord* record : threads_) {
+    uint64_t pinned_epoch = record->epoch.load();
+    if (pinned_epoch != kNotPinned && pinned_epoch != epoch) {
+      return false;
+    }
+  }
+  return global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochDomain::Collect() {
+  uint64_t epoch = global_epoch_.load();
+  size_t kept_count = 0;
+  for (const RetiredObject& object : retired_) {
+    if (object.epoch + 2 <= epoch) {
+      object.deleter(object.pointer);
+    } else {
+      retired_[kept_count++] = object;
+    }
+  }
+  retired_.resize(kept_count);
+}
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- EpochDomain methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_EPOCH_DOMAIN_H
@@ -0,0 +1,256 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_INDEXED_LIST_H
+#define BIDIRECTIONALLIST_INDEXED_LIST_H
+
+// BiDirectionalList with a hash index from value to the nodes holding it.
+// Find, Contains and Erase(value) take O(1) expected time instead of a linear
+// scan, at the price of one hash map entry per element (see IndexMemoryUsage).
+//
+// When the list holds several equal values, Find returns an iterator to any
+// one of them, not necessarily the first in list order. A value changed behind
+// the index would put it out of sync, so the list hands out only constant
+// iterators: Iterator is the same type as ConstIterator.
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "list.h"
+
+template<typename T, typename Hash = std::hash<T>, typename Checks = DefaultIteratorChecks>
+class IndexedBiDirectionalList : protected BiDirectionalList<T, Checks> {
+  using Base = BiDirectionalList<T, Checks>;
+  using Node = typename Base::Node;
+
+ public:
+  using Iterator = typename Base::ConstIterator;
+  using ConstIterator = typename Base::ConstIterator;
+
+  IndexedBiDirectionalList() = default;
+
+  template<typename Container>
+  explicit IndexedBiDirectionalList(const Container&);
+
+  // A copied index would point into the source list
+  IndexedBiDirectionalList(const IndexedBiDirectionalList&) = delete;
+  IndexedBiDirectionalList& operator=(const IndexedBiDirectionalList&) = delete;
+
+  IndexedBiDirectionalList(IndexedBiDirectionalList&&) = default;
+  IndexedBiDirectionalList& operator=(IndexedBiDirectionalList&&) = default;
+
+  using Base::IsEmpty;
+  using Base::Size;
+  using Base::AsArray;
+  using Base::Front;
+  using Base::Back;
+  using Base::CountIf;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  template<typename Predicate>
+  ConstIterator FindIf(Predicate predicate) const;
+
+  void Clear();
+
+  void InsertBefore(Iterator position, const T& value);
+  void InsertBefore(Iterator position, T&& value);
+
+  void InsertAfter(Iterator position, const T& value);
+  void InsertAfter(Iterator position, T&& value);
+
+  void PushBack(const T& value);
+  void PushBack(T&& value);
+
+  void PushFront(const T& value);
+  void PushFront(T&& value);
+
+  void Erase(Iterator position);
+  // Erases one element equal to 'value', returns false if there is none
+  bool Erase(const T& value);
+
+  void PopFront();
+  void PopBack();
+
+  ConstIterator Find(const T& value) const;
+
+  bool Contains(const T& value) const;
+
+  // Approximate number of bytes taken by the index on top of the list itself
+  size_t IndexMemoryUsage() const;
+
+ private:
+  std::unordered_multimap<T, Node*, Hash> index_;
+
+  // Creates an unlinked node which is already in the index. Linking it
+  // can't throw, so a failed insert leaves the list and the index in sync.
+  template<typename U>
+  Node* CreateIndexedNode(U&& value);
+  void RemoveFromIndex(Node* node);
+};
+
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------- IndexedBiDirectionalList methods declaration --------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T, typename Hash, typename Checks>
+template<typename Container>
+IndexedBiDirectionalList<T, Hash, Checks>::IndexedBiDirectionalList(const Container& container) {
+  index_.reserve(container.size());
+  for (const T& item : container) {
+    PushBack(item);
+  }
+}
+
+template<typename T, typename Hash, typename Checks>
+typename IndexedBiDirectionalList<T, Hash, Checks>::ConstIterator IndexedBiDirectionalList<T, Hash, Checks>::begin() const {
+  return Base::begin();
+}
+
+template<typename T, typename Hash, typename Checks>
+typename IndexedBiDirectionalList<T, Hash, Checks>::ConstIterator IndexedBiDirectionalList<T, Hash, Checks>::end() const {
+  return Base::end();
+}
+
+template<typename T, typename Hash, typename Checks>
+template<typename Predicate>
+typename IndexedBiDirectionalList<T, Hash, Checks>::ConstIterator IndexedBiDirectionalList<T, Hash, Checks>::FindIf(Predicate predicate) const {
+  return Base::FindIf(predicate);
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::Clear() {
+  index_.clear();
+  Base::Clear();
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::InsertBefore(Iterator position, const T& value) {
+  Base::InsertBefore(Base::ToNode(position), CreateIndexedNode(value));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::InsertBefore(Iterator position, T&& value) {
+  Base::InsertBefore(Base::ToNode(position), CreateIndexedNode(std::move(value)));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::InsertAfter(Iterator position, const T& value) {
+  Base::InsertAfter(Base::ToNode(position), CreateIndexedNode(value));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::InsertAfter(Iterator position, T&& value) {
+  Base::InsertAfter(Base::ToNode(position), CreateIndexedNode(std::move(value)));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PushBack(const T& value) {
+  Base::InsertAfter(this->last_, CreateIndexedNode(value));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PushBack(T&& value) {
+  Base::InsertAfter(this->last_, CreateIndexedNode(std::move(value)));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PushFront(const T& value) {
+  Base::InsertBefore(this->first_, CreateIndexedNode(value));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PushFront(T&& value) {
+  Base::InsertBefore(this->first_, CreateIndexedNode(std::move(value)));
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::Erase(Iterator position) {
+  Node* node = Base::ToNode(position);
+  if (node == nullptr) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  RemoveFromIndex(node);
+  Base::Erase(node);
+}
+
+template<typename T, typename Hash, typename Checks>
+bool IndexedBiDirectionalList<T, Hash, Checks>::Erase(const T& value) {
+  auto index_position = index_.find(value);
+  if (index_position == index_.end()) {
+    return false;
+  }
+  Node* node = index_position->second;
+  index_.erase(index_position);
+  Base::Erase(node);
+  return true;
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PopFront() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop front element from empty list");
+  }
+  Erase(begin());
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::PopBack() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop back element from empty list");
+  }
+  RemoveFromIndex(this->last_);
+  Base::Erase(this->last_);
+}
+
+template<typename T, typename Hash, typename Checks>
+typename IndexedBiDirectionalList<T, Hash, Checks>::ConstIterator IndexedBiDirectionalList<T, Hash, Checks>::Find(const T& value) const {
+  auto index_position = index_.find(value);
+  return Base::ToIterator(index_position != index_.end() ? index_position->second : nullptr);
+}
+
+template<typename T, typename Hash, typename Checks>
+bool IndexedBiDirectionalList<T, Hash, Checks>::Contains(const T& value) const {
+  return index_.find(value) != index_.end();
+}
+
+template<typename T, typename Hash, typename Checks>
+size_t IndexedBiDirectionalList<T, Hash, Checks>::IndexMemoryUsage() const {
+  // Every entry is a separately allocated hash node: the stored pair,
+  // a 'next' pointer and the cached hash code
+  const size_t entry_size = sizeof(typename decltype(index_)::value_type) + sizeof(void*) + sizeof(size_t);
+  return sizeof(index_) + index_.bucket_count() * sizeof(void*) + index_.size() * entry_size;
+}
+
+template<typename T, typename Hash, typename Checks>
+template<typename U>
+typename IndexedBiDirectionalList<T, Hash, Checks>::Node* IndexedBiDirectionalList<T, Hash, Checks>::CreateIndexedNode(U&& value) {
+  Node* node = new Node(std::forward<U>(value));
+  try {
+    index_.emplace(node->value_, node);
+  } catch (...) {
+    delete node;
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Hash, typename Checks>
+void IndexedBiDirectionalList<T, Hash, Checks>::RemoveFromIndex(Node* node) {
+  auto range = index_.equal_range(node->value_);
+  for (auto index_position = range.first; index_position != range.second; ++index_position) {
+    if (index_position->second == node) {
+      index_.erase(index_position);
+      return;
+    }
+  }
+}
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------- IndexedBiDirectionalList methods declaration --------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_INDEXED_LIST_H
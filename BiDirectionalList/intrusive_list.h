@@ -0,0 +1,570 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_INTRUSIVE_LIST_H
+#define BIDIRECTIONALLIST_INTRUSIVE_LIST_H
+
+// Intrusive variant of BiDirectionalList for objects which already live
+// elsewhere. The element type embeds the links by deriving from
+// IntrusiveListHook, so inserting and erasing only relink existing objects:
+// no allocation and no copy per element. Erase(object) is O(1).
+//
+// The list does not own its elements: Clear() and the destructor only unlink
+// them. An object must be erased from the list before it is destroyed.
+// An object can be linked into several lists at once if it derives from
+// several hooks with different tags.
+//
+//   struct Connection : IntrusiveListHook<> { ... };
+//   IntrusiveList<Connection> connections;
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <iterator>
+#include <functional>
+
+template<typename Tag = void>
+class IntrusiveListHook {
+ public:
+  IntrusiveListHook() : list_(nullptr), next_hook_(nullptr), previous_hook_(nullptr) {}
+
+  // Copies of an object are not linked anywhere
+  IntrusiveListHook(const IntrusiveListHook&) : IntrusiveListHook() {}
+  IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+  bool IsLinked() const { return list_ != nullptr; }
+
+ private:
+  template<typename T, typename ListTag>
+  friend class IntrusiveList;
+
+  const void* list_;
+  IntrusiveListHook* next_hook_;
+  IntrusiveListHook* previous_hook_;
+};
+
+template<typename T, typename Tag = void>
+class IntrusiveList {
+  using Hook = IntrusiveListHook<Tag>;
+
+ public:
+  class Iterator : public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    Iterator(const Iterator& other) = default;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    Iterator& operator++();
+    const Iterator operator++(int);
+
+    Iterator& operator--();
+    const Iterator operator--(int);
+
+    Iterator& operator=(const Iterator& other);
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class IntrusiveList;
+
+    const IntrusiveList* const list_;
+    Hook* hook_;
+
+    Iterator(const IntrusiveList* const list, Hook* hook)
+        : list_(list), hook_(hook) {}
+  };
+
+  class ConstIterator :
+      public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    ConstIterator(const ConstIterator& other) = default;
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    ConstIterator& operator++();
+    const ConstIterator operator++(int);
+
+    ConstIterator& operator--();
+    const ConstIterator operator--(int);
+
+    ConstIterator& operator=(const ConstIterator& other);
+    bool operator==(const ConstIterator& other) const;
+    bool operator!=(const ConstIterator& other) const;
+
+   private:
+    friend class IntrusiveList;
+
+    const IntrusiveList* const list_;
+    const Hook* hook_;
+
+    ConstIterator(const IntrusiveList* const list, const Hook* hook)
+        : list_(list), hook_(hook) {}
+  };
+
+  IntrusiveList() : size_(0), first_(nullptr), last_(nullptr) {}
+
+  IntrusiveList(const IntrusiveList&) = delete;
+  IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+  ~IntrusiveList() { Clear(); }
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  // Unlinks all the elements, the objects themselves are left untouched
+  void Clear();
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  // Iterator to an object linked into this list, O(1)
+  Iterator IteratorTo(T& object);
+  ConstIterator IteratorTo(const T& object) const;
+
+  bool Contains(const T& object) const;
+
+  std::vector<T*> AsArray() const;
+
+  void InsertBefore(Iterator position, T& object);
+  void InsertAfter(Iterator position, T& object);
+
+  void PushBack(T& object);
+  void PushFront(T& object);
+
+  void Erase(Iterator position);
+  void Erase(T& object);
+
+  void PopFront();
+  void PopBack();
+
+  T& Front();
+  const T& Front() const;
+  T& Back();
+  const T& Back() const;
+
+  Iterator Find(std::function<bool(const T&)> predicate);
+  ConstIterator Find(std::function<bool(const T&)> predicate) const;
+
+ private:
+  size_t size_;
+
+  Hook* first_;
+  Hook* last_;
+
+  static T& ToObject(Hook* hook);
+  static const T& ToObject(const Hook* hook);
+
+  // The iterator comes from this list and still points into it
+  bool Owns(Iterator position) const;
+
+  void InsertBefore(Hook* existing_hook, Hook* new_hook);
+  void Erase(Hook* hook);
+};
+
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+template<typename T, typename Tag>
+T& IntrusiveList<T, Tag>::Iterator::operator*() const {
+  if (hook_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return ToObject(hook_);
+}
+
+template<typename T, typename Tag>
+T* IntrusiveList<T, Tag>::Iterator::operator->() const {
+  if (hook_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &ToObject(hook_);
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator& IntrusiveList<T, Tag>::Iterator::operator++() {
+  if (hook_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  hook_ = hook_->next_hook_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+const typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::Iterator::operator++(int) {
+  Iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator& IntrusiveList<T, Tag>::Iterator::operator--() {
+  if (hook_ == list_->first_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  hook_ = hook_ ? hook_->previous_hook_ : list_->last_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+const typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::Iterator::operator--(int) {
+  Iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator& IntrusiveList<T, Tag>::Iterator::operator=(const IntrusiveList::Iterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  hook_ = other.hook_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::Iterator::operator==(const IntrusiveList::Iterator& other) const {
+  return hook_ == other.hook_;
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::Iterator::operator!=(const IntrusiveList::Iterator& other) const {
+  return hook_ != other.hook_;
+}
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+
+
+
+
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+template<typename T, typename Tag>
+const T& IntrusiveList<T, Tag>::ConstIterator::operator*() const {
+  if (hook_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return ToObject(hook_);
+}
+
+template<typename T, typename Tag>
+const T* IntrusiveList<T, Tag>::ConstIterator::operator->() const {
+  if (hook_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &ToObject(hook_);
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator& IntrusiveList<T, Tag>::ConstIterator::operator++() {
+  if (hook_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  hook_ = hook_->next_hook_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+const typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator& IntrusiveList<T, Tag>::ConstIterator::operator--() {
+  if (hook_ == list_->first_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  hook_ = hook_ ? hook_->previous_hook_ : list_->last_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+const typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator& IntrusiveList<T, Tag>::ConstIterator::operator=(const IntrusiveList::ConstIterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  hook_ = other.hook_;
+  return *this;
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::ConstIterator::operator==(const IntrusiveList::ConstIterator& other) const {
+  return hook_ == other.hook_;
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::ConstIterator::operator!=(const IntrusiveList::ConstIterator& other) const {
+  return hook_ != other.hook_;
+}
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------------- IntrusiveList methods declaration -------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template<typename T, typename Tag>
+size_t IntrusiveList<T, Tag>::Size() const {
+  return size_;
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::Clear() {
+  Hook* hook = first_;
+  while (hook != nullptr) {
+    Hook* next_hook = hook->next_hook_;
+    hook->list_ = nullptr;
+    hook->next_hook_ = hook->previous_hook_ = nullptr;
+    hook = next_hook;
+  }
+  first_ = last_ = nullptr;
+  size_ = 0;
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::begin() {
+  return {this, first_};
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::end() {
+  return {this, nullptr};
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::begin() const {
+  return {this, first_};
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::end() const {
+  return {this, nullptr};
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::IteratorTo(T& object) {
+  if (!Contains(object)) {
+    throw std::invalid_argument("object is not linked into this list");
+  }
+  return {this, static_cast<Hook*>(&object)};
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::IteratorTo(const T& object) const {
+  if (!Contains(object)) {
+    throw std::invalid_argument("object is not linked into this list");
+  }
+  return {this, static_cast<const Hook*>(&object)};
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::Contains(const T& object) const {
+  return static_cast<const Hook&>(object).list_ == this;
+}
+
+template<typename T, typename Tag>
+bool IntrusiveList<T, Tag>::Owns(IntrusiveList::Iterator position) const {
+  return position.list_ == this && (position.hook_ == nullptr || position.hook_->list_ == this);
+}
+
+template<typename T, typename Tag>
+std::vector<T*> IntrusiveList<T, Tag>::AsArray() const {
+  std::vector<T*> array;
+  array.reserve(size_);
+  for (Hook* hook = first_; hook != nullptr; hook = hook->next_hook_) {
+    array.push_back(&ToObject(hook));
+  }
+  return array;
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::InsertBefore(IntrusiveList::Iterator position, T& object) {
+  if (!Owns(position)) {
+    throw std::invalid_argument("iterator does not belong to this list");
+  }
+  InsertBefore(position.hook_, static_cast<Hook*>(&object));
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::InsertAfter(IntrusiveList::Iterator position, T& object) {
+  if (!Owns(position)) {
+    throw std::invalid_argument("iterator does not belong to this list");
+  }
+  InsertBefore(position.hook_ ? position.hook_->next_hook_ : nullptr, static_cast<Hook*>(&object));
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::PushBack(T& object) {
+  InsertBefore(nullptr, static_cast<Hook*>(&object));
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::PushFront(T& object) {
+  InsertBefore(first_, static_cast<Hook*>(&object));
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::Erase(IntrusiveList::Iterator position) {
+  if (position.hook_ == nullptr) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  if (!Owns(position)) {
+    throw std::invalid_argument("iterator does not belong to this list");
+  }
+  Erase(position.hook_);
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::Erase(T& object) {
+  if (!Contains(object)) {
+    throw std::invalid_argument("object is not linked into this list");
+  }
+  Erase(static_cast<Hook*>(&object));
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::PopFront() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop front element from empty list");
+  }
+  Erase(first_);
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::PopBack() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop back element from empty list");
+  }
+  Erase(last_);
+}
+
+template<typename T, typename Tag>
+T& IntrusiveList<T, Tag>::Front() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access front element in empty list");
+  }
+  return ToObject(first_);
+}
+
+template<typename T, typename Tag>
+const T& IntrusiveList<T, Tag>::Front() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access front element in empty list");
+  }
+  return ToObject(first_);
+}
+
+template<typename T, typename Tag>
+T& IntrusiveList<T, Tag>::Back() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access back element in empty list");
+  }
+  return ToObject(last_);
+}
+
+template<typename T, typename Tag>
+const T& IntrusiveList<T, Tag>::Back() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access back element in empty list");
+  }
+  return ToObject(last_);
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::Find(std::function<bool(const T&)> predicate) {
+  for (auto iterator = begin(); iterator != end(); ++iterator) {
+    if (predicate(*iterator)) {
+      return iterator;
+    }
+  }
+  return end();
+}
+
+template<typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::Find(std::function<bool(const T&)> predicate) const {
+  for (auto iterator = begin(); iterator != end(); ++iterator) {
+    if (predicate(*iterator)) {
+      return iterator;
+    }
+  }
+  return end();
+}
+
+template<typename T, typename Tag>
+T& IntrusiveList<T, Tag>::ToObject(Hook* hook) {
+  return *static_cast<T*>(hook);
+}
+
+template<typename T, typename Tag>
+const T& IntrusiveList<T, Tag>::ToObject(const Hook* hook) {
+  return *static_cast<const T*>(hook);
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::InsertBefore(Hook* existing_hook, Hook* new_hook) {
+  if (new_hook->IsLinked()) {
+    throw std::invalid_argument("object is already linked into a list");
+  }
+  new_hook->list_ = this;
+  new_hook->next_hook_ = existing_hook;
+  if (existing_hook != nullptr) {
+    new_hook->previous_hook_ = existing_hook->previous_hook_;
+    existing_hook->previous_hook_ = new_hook;
+  } else {
+    new_hook->previous_hook_ = last_;
+    last_ = new_hook;
+  }
+  if (new_hook->previous_hook_ != nullptr) {
+    new_hook->previous_hook_->next_hook_ = new_hook;
+  } else {
+    first_ = new_hook;
+  }
+  ++size_;
+}
+
+template<typename T, typename Tag>
+void IntrusiveList<T, Tag>::Erase(Hook* hook) {
+  if (hook->previous_hook_ != nullptr) {
+    hook->previous_hook_->next_hook_ = hook->next_hook_;
+  } else {
+    first_ = hook->next_hook_;
+  }
+  if (hook->next_hook_ != nullptr) {
+    hook->next_hook_->previous_hook_ = hook->previous_hook_;
+  } else {
+    last_ = hook->previous_hook_;
+  }
+  hook->list_ = nullptr;
+  hook->next_hook_ = hook->previous_hook_ = nullptr;
+  --size_;
+}
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------------- IntrusiveList methods declaration -------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_INTRUSIVE_LIST_H
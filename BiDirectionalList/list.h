@@ -16,8 +16,32 @@
 #include <vector>
 #include <iterator>
 #include <functional>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <thread>
+#include <exception>
+
+// Iterator checking policies. With CheckedIterators every dereference, step
+// and assignment of an iterator is validated and misuse throws an exception;
+// UncheckedIterators compiles these checks out of the iteration hot path.
+struct CheckedIterators {
+  static constexpr bool kEnabled = true;
+};
+
+struct UncheckedIterators {
+  static constexpr bool kEnabled = false;
+};
 
-template<typename T>
+// Release builds may define BIDIRECTIONALLIST_UNCHECKED_ITERATORS to make
+// unchecked iterators the default for every list.
+#ifdef BIDIRECTIONALLIST_UNCHECKED_ITERATORS
+using DefaultIteratorChecks = UncheckedIterators;
+#else
+using DefaultIteratorChecks = CheckedIterators;
+#endif
+
+template<typename T, typename Checks = DefaultIteratorChecks>
 class BiDirectionalList {
  protected:
   struct Node;
@@ -25,6 +49,8 @@ class BiDirectionalList {
  public:
   class Iterator : public std::iterator<std::bidirectional_iterator_tag, T> {
    public:
+    Iterator(const Iterator& other) = default;
+
     T& operator*() const;
     T* operator->() const;
 
@@ -51,6 +77,8 @@ class BiDirectionalList {
   class ConstIterator :
       public std::iterator<std::bidirectional_iterator_tag, T> {
    public:
+    ConstIterator(const ConstIterator& other) = default;
+
     const T& operator*() const;
     const T* operator->() const;
 
@@ -79,6 +107,22 @@ class BiDirectionalList {
   template<typename Container>
   explicit BiDirectionalList(const Container&);
 
+  // Nodes of a range with forward iterators are allocated in one contiguous
+  // block, which is released when the last of its nodes is erased: a single
+  // surviving node keeps the memory of the whole block allocated
+  template<typename InputIterator>
+  BiDirectionalList(InputIterator first, InputIterator last);
+
+  // The copy is allocated in one block
+  BiDirectionalList(const BiDirectionalList& other);
+  // Moves take the nodes over, iterators to them keep pointing to 'other'
+  BiDirectionalList(BiDirectionalList&& other) noexcept;
+
+  // Assigns over the existing nodes, only the difference in size
+  // is allocated or released
+  BiDirectionalList& operator=(const BiDirectionalList& other);
+  BiDirectionalList& operator=(BiDirectionalList&& other) noexcept;
+
   ~BiDirectionalList() { Clear(); }
 
   bool IsEmpty() const;
@@ -95,6 +139,16 @@ class BiDirectionalList {
 
   std::vector<T> AsArray() const;
 
+  // Moves the values out and releases the nodes in one pass,
+  // the list is empty afterwards
+  std::vector<T> DrainToVector();
+
+  // Reallocates the nodes into one block in list order, so that a traversal
+  // walks memory sequentially again after a long insert/erase churn. Also
+  // releases the blocks kept allocated by a few surviving nodes.
+  // Invalidates all iterators.
+  void Compact();
+
   void InsertBefore(Iterator position, const T& value);
   void InsertBefore(Iterator position, T&& value);
 
@@ -107,7 +161,26 @@ class BiDirectionalList {
   void PushFront(const T& value);
   void PushFront(T&& value);
 
+  // Construct the element in place from 'args'
+  template<typename... Args>
+  void EmplaceBack(Args&&... args);
+  template<typename... Args>
+  void EmplaceFront(Args&&... args);
+
   void Erase(Iterator position);
+  // Erases [first, last): the span is unlinked with O(1) pointer updates and
+  // its nodes are released in one loop. 'last' must be reachable from 'first'.
+  // Returns the number of erased elements.
+  size_t Erase(Iterator first, Iterator last);
+
+  // Keeps the first 'count' elements
+  void Truncate(size_t count);
+  // Erases the first 'count' elements, or all of them if there are fewer
+  void DropFront(size_t count);
+
+  // Relinks the element to the front, the node is not reallocated and
+  // iterators to it stay valid
+  void MoveToFront(Iterator position);
 
   void PopFront();
   void PopBack();
@@ -121,93 +194,204 @@ class BiDirectionalList {
   Iterator Find(std::function<bool(const T&)> predicate);
   ConstIterator Find(std::function<bool(const T&)> predicate) const;
 
+  // Algorithms taking an arbitrary callable. Unlike Find(std::function) the
+  // callable is not type-erased, so it can be inlined into the loop.
+  template<typename Predicate>
+  Iterator FindIf(Predicate predicate);
+  template<typename Predicate>
+  ConstIterator FindIf(Predicate predicate) const;
+
+  template<typename Predicate>
+  size_t CountIf(Predicate predicate) const;
+
+  // Erases all the elements satisfying predicate, returns their count
+  template<typename Predicate>
+  size_t RemoveIf(Predicate predicate);
+
+  template<typename Function>
+  void ForEach(Function function);
+  template<typename Function>
+  void ForEach(Function function) const;
+
+  // Run function(element) on 'threads_count' threads, hardware_concurrency()
+  // by default. Every thread gets a contiguous range of whole chunks, so
+  // function must be safe to call concurrently for different elements.
+  template<typename Function>
+  void ParallelForEach(Function function, size_t threads_count = 0);
+  template<typename Function>
+  void ParallelForEach(Function function, size_t threads_count = 0) const;
+
+  // Every thread folds its range with accumulate(partial, element) starting
+  // from 'identity', then the partial results are folded with
+  // combine(result, partial) in list order
+  template<typename Result, typename Accumulate, typename Combine>
+  Result ParallelReduce(Result identity, Accumulate accumulate, Combine combine, size_t threads_count = 0) const;
+
+  // Stable partition by relinking nodes: the elements satisfying predicate
+  // go first. Returns an iterator to the first element of the second group.
+  template<typename Predicate>
+  Iterator Partition(Predicate predicate);
+
  protected:
+  // Selects the constructor of Node which forwards its arguments to T
+  struct EmplaceTag {};
+
   struct Node {
     Node(const T& value);
     Node(T&& value);
+    template<typename... Args>
+    Node(EmplaceTag, Args&&... args);
 
     T value_;
     Node* next_node_;
     Node* previous_node_;
   };
 
+  // Raw storage for nodes allocated in bulk. It is released together with
+  // its last alive node, however many of the others were erased before.
+  struct NodeBlock {
+    Node* nodes_;
+    size_t count_;
+    size_t alive_count_;
+  };
+
   size_t size_;
 
   Node* first_;
   Node* last_;
 
+  // Blocks with alive nodes sorted by address. Nodes don't know their block,
+  // so a list built node by node pays nothing for bulk allocation.
+  std::vector<NodeBlock> blocks_;
+
+  // First nodes of the chunks of kChunkSize consecutive nodes, which split the
+  // list for parallel traversals. They are recorded for free when a block is
+  // linked into an empty list (bulk build, copy, Compact), otherwise computed
+  // by one walk; any relinking drops them.
+  static const size_t kChunkSize = 4096;
+
+  std::vector<Node*> chunk_starts_;
+  bool chunk_starts_valid_ = false;
+
   void InsertBefore(Node* existing_node, Node* new_node);
   void InsertAfter(Node* existing_node, Node* new_node);
   void Erase(Node* node);
+  // Excludes the node from the list without destroying it
+  void Unlink(Node* node);
+  // Erases [first, last), nullptr stands for the end of the list
+  size_t EraseSpan(Node* first, Node* last);
+
+  // Walks from the nearer end, 'index' may be equal to size_
+  Node* NodeAt(size_t index) const;
+
+  template<typename InputIterator>
+  void AppendRange(InputIterator first, InputIterator last, std::input_iterator_tag);
+  template<typename ForwardIterator>
+  void AppendRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+  // Constructs 'count' nodes in a new block and links them after last_
+  template<typename ForwardIterator>
+  void AppendBlock(ForwardIterator first, size_t count);
+
+  // Every node is released here: nodes from a block are destroyed in place,
+  // the others were allocated with new. Without blocks this is a plain
+  // delete, otherwise the node is looked up in blocks_ in O(log(blocks count)).
+  void DestroyNode(Node* node);
+
+  // Links 'count' constructed nodes after last_ and records them as a block,
+  // blocks_ must have room for one more entry
+  void LinkBlock(Node* nodes, size_t count);
+
+  // Traversals prefetch the node this many hops ahead of the current one
+  static const size_t kPrefetchDistance = 4;
+
+  static const Node* Advance(const Node* node, size_t steps);
+  static void PrefetchNext(const Node*& ahead);
+
+  std::vector<Node*> ComputeChunkStarts() const;
+
+  // Calls process(first, last, range_index) for 'ranges_count' contiguous
+  // ranges of chunks, each on its own thread (the last one on the calling
+  // thread), and rethrows the first exception thrown by process
+  template<typename Process>
+  static void RunOnRanges(const std::vector<Node*>& chunk_starts, size_t ranges_count, Process process);
+  static size_t RangesCount(size_t threads_count, size_t chunks_count);
+
+  // Conversions between iterators and nodes for the derived lists,
+  // which are not friends of the iterator classes.
+  static Node* ToNode(Iterator position);
+  static Node* ToNode(ConstIterator position);
+  Iterator ToIterator(Node* node);
+  ConstIterator ToIterator(Node* node) const;
 };
 
 // |--------------------------------------------------------------------------------------|
 // |----------------------------- Iterator methods declaration ---------------------------|
 // |--------------------------------------------------------------------------------------|
-template<typename T>
-T& BiDirectionalList<T>::Iterator::operator*() const {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+T& BiDirectionalList<T, Checks>::Iterator::operator*() const {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::invalid_argument("operator* from end() iterator");
   }
   return node_->value_;
 }
 
-template<typename T>
-T* BiDirectionalList<T>::Iterator::operator->() const {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+T* BiDirectionalList<T, Checks>::Iterator::operator->() const {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::invalid_argument("operator* from end() iterator");
   }
   return &(node_->value_);
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator& BiDirectionalList<T>::Iterator::operator++() {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator& BiDirectionalList<T, Checks>::Iterator::operator++() {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::out_of_range("Trying to increment end() iterator");
   }
   node_ = node_->next_node_;
   return *this;
 }
 
-template<typename T>
-const typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::Iterator::operator++(int) {
+template<typename T, typename Checks>
+const typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::Iterator::operator++(int) {
   Iterator temp = *this;
   ++(*this);
   return temp;
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator& BiDirectionalList<T>::Iterator::operator--() {
-  if (node_ == list_->first_) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator& BiDirectionalList<T, Checks>::Iterator::operator--() {
+  if (Checks::kEnabled && node_ == list_->first_) {
     throw std::out_of_range("Trying to decrement begin() iterator");
   }
   node_ = node_ ? node_->previous_node_ : list_->last_;
   return *this;
 }
 
-template<typename T>
-const typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::Iterator::operator--(int) {
+template<typename T, typename Checks>
+const typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::Iterator::operator--(int) {
   Iterator temp = *this;
   --(*this);
   return temp;
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator& BiDirectionalList<T>::Iterator::operator=(const BiDirectionalList::Iterator& other) {
-  if (list_ != other.list_) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator& BiDirectionalList<T, Checks>::Iterator::operator=(const BiDirectionalList::Iterator& other) {
+  if (Checks::kEnabled && list_ != other.list_) {
     throw std::invalid_argument("Trying to assign iterator from another list");
   }
   node_ = other.node_;
   return *this;
 }
 
-template<typename T>
-bool BiDirectionalList<T>::Iterator::operator==(const BiDirectionalList::Iterator& other) const {
+template<typename T, typename Checks>
+bool BiDirectionalList<T, Checks>::Iterator::operator==(const BiDirectionalList::Iterator& other) const {
   return node_ == other.node_;
 }
 
-template<typename T>
-bool BiDirectionalList<T>::Iterator::operator!=(const BiDirectionalList::Iterator& other) const {
+template<typename T, typename Checks>
+bool BiDirectionalList<T, Checks>::Iterator::operator!=(const BiDirectionalList::Iterator& other) const {
   return node_ != other.node_;
 }
 // |--------------------------------------------------------------------------------------|
@@ -220,70 +404,70 @@ bool BiDirectionalList<T>::Iterator::operator!=(const BiDirectionalList::Iterato
 // |------------------------------------------------------------------------------------------|
 // |---------------------------- ConstIterator methods declaration ---------------------------|
 // |------------------------------------------------------------------------------------------|
-template<typename T>
-const T& BiDirectionalList<T>::ConstIterator::operator*() const {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+const T& BiDirectionalList<T, Checks>::ConstIterator::operator*() const {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::invalid_argument("operator* from end() iterator");
   }
   return node_->value_;
 }
 
-template<typename T>
-const T* BiDirectionalList<T>::ConstIterator::operator->() const {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+const T* BiDirectionalList<T, Checks>::ConstIterator::operator->() const {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::invalid_argument("operator* from end() iterator");
   }
   return &(node_->value_);
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator& BiDirectionalList<T>::ConstIterator::operator++() {
-  if (node_ == nullptr) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator& BiDirectionalList<T, Checks>::ConstIterator::operator++() {
+  if (Checks::kEnabled && node_ == nullptr) {
     throw std::out_of_range("Trying to increment end() iterator");
   }
   node_ = node_->next_node_;
   return *this;
 }
 
-template<typename T>
-const typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::ConstIterator::operator++(int) {
+template<typename T, typename Checks>
+const typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::ConstIterator::operator++(int) {
   ConstIterator temp = *this;
   ++(*this);
   return temp;
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator& BiDirectionalList<T>::ConstIterator::operator--() {
-  if (node_ == list_->first_) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator& BiDirectionalList<T, Checks>::ConstIterator::operator--() {
+  if (Checks::kEnabled && node_ == list_->first_) {
     throw std::out_of_range("Trying to decrement begin() iterator");
   }
   node_ = node_ ? node_->previous_node_ : list_->last_;
   return *this;
 }
 
-template<typename T>
-const typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::ConstIterator::operator--(int) {
+template<typename T, typename Checks>
+const typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::ConstIterator::operator--(int) {
   ConstIterator temp = *this;
   --(*this);
   return temp;
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator& BiDirectionalList<T>::ConstIterator::operator=(const BiDirectionalList::ConstIterator& other) {
-  if (list_ != other.list_) {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator& BiDirectionalList<T, Checks>::ConstIterator::operator=(const BiDirectionalList::ConstIterator& other) {
+  if (Checks::kEnabled && list_ != other.list_) {
     throw std::invalid_argument("Trying to assign iterator from another list");
   }
   node_ = other.node_;
   return *this;
 }
 
-template<typename T>
-bool BiDirectionalList<T>::ConstIterator::operator==(const BiDirectionalList::ConstIterator& other) const {
+template<typename T, typename Checks>
+bool BiDirectionalList<T, Checks>::ConstIterator::operator==(const BiDirectionalList::ConstIterator& other) const {
   return node_ == other.node_;
 }
 
-template<typename T>
-bool BiDirectionalList<T>::ConstIterator::operator!=(const BiDirectionalList::ConstIterator& other) const {
+template<typename T, typename Checks>
+bool BiDirectionalList<T, Checks>::ConstIterator::operator!=(const BiDirectionalList::ConstIterator& other) const {
   return node_ != other.node_;
 }
 // |------------------------------------------------------------------------------------------|
@@ -297,18 +481,24 @@ bool BiDirectionalList<T>::ConstIterator::operator!=(const BiDirectionalList::Co
 // |---------------------------------------------------------------------------------|
 // |---------------------------- Node methods declaration ---------------------------|
 // |---------------------------------------------------------------------------------|
-template<typename T>
-BiDirectionalList<T>::Node::Node(const T& value) : value_(value),
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>::Node::Node(const T& value) : value_(value),
                                                    next_node_(nullptr),
                                                    previous_node_(nullptr) {}
 
-template<typename T>
-BiDirectionalList<T>::Node::Node(T&& value) : value_(value),
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>::Node::Node(T&& value) : value_(std::move(value)),
                                               next_node_(nullptr),
                                               previous_node_(nullptr) {
   value = T();
 }
 
+template<typename T, typename Checks>
+template<typename... Args>
+BiDirectionalList<T, Checks>::Node::Node(EmplaceTag, Args&&... args) : value_(std::forward<Args>(args)...),
+                                                                    next_node_(nullptr),
+                                                                    previous_node_(nullptr) {}
+
 // |---------------------------------------------------------------------------------|
 // |---------------------------- Node methods declaration ---------------------------|
 // |---------------------------------------------------------------------------------|
@@ -319,179 +509,323 @@ BiDirectionalList<T>::Node::Node(T&& value) : value_(value),
 // |---------------------------------------------------------------------------------------------------|
 // |------------------------------- BiDirectionalList methods declaration -----------------------------|
 // |---------------------------------------------------------------------------------------------------|
-template<typename T>
+template<typename T, typename Checks>
 template<typename Container>
-BiDirectionalList<T>::BiDirectionalList(const Container& container) : size_(0), first_(nullptr), last_(nullptr) {
-  for (const T& item : container) {
-    PushBack(item);
+BiDirectionalList<T, Checks>::BiDirectionalList(const Container& container)
+    : BiDirectionalList(std::begin(container), std::end(container)) {}
+
+template<typename T, typename Checks>
+template<typename InputIterator>
+BiDirectionalList<T, Checks>::BiDirectionalList(InputIterator first, InputIterator last)
+    : size_(0), first_(nullptr), last_(nullptr) {
+  try {
+    AppendRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+  } catch (...) {
+    Clear();
+    throw;
   }
 }
 
-template<typename T>
-bool BiDirectionalList<T>::IsEmpty() const {
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>::BiDirectionalList(const BiDirectionalList& other)
+    : size_(0), first_(nullptr), last_(nullptr) {
+  AppendBlock(other.begin(), other.size_);
+}
+
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>::BiDirectionalList(BiDirectionalList&& other) noexcept
+    : size_(other.size_), first_(other.first_), last_(other.last_), blocks_(std::move(other.blocks_)),
+      chunk_starts_(std::move(other.chunk_starts_)), chunk_starts_valid_(other.chunk_starts_valid_) {
+  other.size_ = 0;
+  other.first_ = other.last_ = nullptr;
+  other.blocks_.clear();
+  other.chunk_starts_.clear();
+  other.chunk_starts_valid_ = false;
+}
+
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>& BiDirectionalList<T, Checks>::operator=(const BiDirectionalList& other) {
+  if (this == &other) {
+    return *this;
+  }
+  Node* node = first_;
+  const Node* other_node = other.first_;
+  while (node != nullptr && other_node != nullptr) {
+    node->value_ = other_node->value_;
+    node = node->next_node_;
+    other_node = other_node->next_node_;
+  }
+
+  if (node != nullptr) {
+    EraseSpan(node, nullptr);
+  } else if (other_node != nullptr) {
+    AppendBlock(ConstIterator(&other, const_cast<Node*>(other_node)), other.size_ - size_);
+  }
+  return *this;
+}
+
+template<typename T, typename Checks>
+BiDirectionalList<T, Checks>& BiDirectionalList<T, Checks>::operator=(BiDirectionalList&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+  Clear();
+  size_ = other.size_;
+  first_ = other.first_;
+  last_ = other.last_;
+  blocks_ = std::move(other.blocks_);
+  chunk_starts_ = std::move(other.chunk_starts_);
+  chunk_starts_valid_ = other.chunk_starts_valid_;
+  other.size_ = 0;
+  other.first_ = other.last_ = nullptr;
+  other.blocks_.clear();
+  other.chunk_starts_.clear();
+  other.chunk_starts_valid_ = false;
+  return *this;
+}
+
+template<typename T, typename Checks>
+bool BiDirectionalList<T, Checks>::IsEmpty() const {
   return size_ == 0;
 }
 
-template<typename T>
-size_t BiDirectionalList<T>::Size() const {
+template<typename T, typename Checks>
+size_t BiDirectionalList<T, Checks>::Size() const {
   return size_;
 }
 
-template<typename T>
-void BiDirectionalList<T>::Clear() {
-  auto iterator = begin();
-  while (iterator != end()) {
-    auto next_iterator = ++iterator;
-    iterator = next_iterator;
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Clear() {
+  Node* node = first_;
+  while (node != nullptr) {
+    Node* next_node = node->next_node_;
+    DestroyNode(node);
+    node = next_node;
   }
+  first_ = last_ = nullptr;
   size_ = 0;
+  chunk_starts_valid_ = false;
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::begin() {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::begin() {
   return {this, first_};
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::end() {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::end() {
   return {this, nullptr};
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::begin() const {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::begin() const {
   return {this, first_};
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::end() const {
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::end() const {
   return {this, nullptr};
 }
 
-template<typename T>
-std::vector<T> BiDirectionalList<T>::AsArray() const {
+template<typename T, typename Checks>
+std::vector<T> BiDirectionalList<T, Checks>::AsArray() const {
   std::vector<T> array;
-  for (auto iterator = begin(); iterator != end(); ++iterator) {
-    array.push_back(*iterator);
+  array.reserve(size_);
+  const Node* ahead = Advance(first_, kPrefetchDistance);
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    PrefetchNext(ahead);
+    array.push_back(node->value_);
   }
   return array;
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertBefore(BiDirectionalList::Iterator position, const T& value) {
+template<typename T, typename Checks>
+std::vector<T> BiDirectionalList<T, Checks>::DrainToVector() {
+  std::vector<T> array;
+  array.reserve(size_);
+  chunk_starts_valid_ = false;
+  while (first_ != nullptr) {
+    array.push_back(std::move(first_->value_));
+    Node* next_node = first_->next_node_;
+    DestroyNode(first_);
+    first_ = next_node;
+    if (first_ != nullptr) {
+      first_->previous_node_ = nullptr;
+    }
+    --size_;
+  }
+  last_ = nullptr;
+  return array;
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Compact() {
+  const size_t count = size_;
+  if (count == 0) {
+    return;
+  }
+  Node* nodes = static_cast<Node*>(::operator new(count * sizeof(Node)));
+  size_t constructed_count = 0;
+  try {
+    blocks_.reserve(blocks_.size() + 1);
+    for (Node* node = first_; node != nullptr; node = node->next_node_) {
+      new (nodes + constructed_count) Node(std::move_if_noexcept(node->value_));
+      ++constructed_count;
+    }
+  } catch (...) {
+    while (constructed_count > 0) {
+      nodes[--constructed_count].~Node();
+    }
+    ::operator delete(nodes);
+    throw;
+  }
+  Clear();
+  LinkBlock(nodes, count);
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertBefore(BiDirectionalList::Iterator position, const T& value) {
   InsertBefore(position.node_, new Node(value));
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertBefore(BiDirectionalList::Iterator position, T&& value) {
-  InsertBefore(position.node_, std::move(new Node(value)));
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertBefore(BiDirectionalList::Iterator position, T&& value) {
+  InsertBefore(position.node_, new Node(std::move(value)));
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertAfter(BiDirectionalList::Iterator position, const T& value) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertAfter(BiDirectionalList::Iterator position, const T& value) {
   InsertAfter(position.node_, new Node(value));
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertAfter(BiDirectionalList::Iterator position, T&& value) {
-  InsertAfter(position.node_, std::move(new Node(value)));
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertAfter(BiDirectionalList::Iterator position, T&& value) {
+  InsertAfter(position.node_, new Node(std::move(value)));
 }
 
-template<typename T>
-void BiDirectionalList<T>::PushBack(const T& value) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PushBack(const T& value) {
   InsertAfter(last_, new Node(value));
 }
 
-template<typename T>
-void BiDirectionalList<T>::PushBack(T&& value) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PushBack(T&& value) {
   InsertAfter(last_, new Node(std::move(value)));
 }
 
-template<typename T>
-void BiDirectionalList<T>::PushFront(const T& value) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PushFront(const T& value) {
   InsertBefore(first_, new Node(value));
 }
 
-template<typename T>
-void BiDirectionalList<T>::PushFront(T&& value) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PushFront(T&& value) {
   InsertBefore(first_, new Node(std::move(value)));
 }
 
-template<typename T>
-void BiDirectionalList<T>::Erase(BiDirectionalList::Iterator position) {
+template<typename T, typename Checks>
+template<typename... Args>
+void BiDirectionalList<T, Checks>::EmplaceBack(Args&&... args) {
+  InsertAfter(last_, new Node(EmplaceTag(), std::forward<Args>(args)...));
+}
+
+template<typename T, typename Checks>
+template<typename... Args>
+void BiDirectionalList<T, Checks>::EmplaceFront(Args&&... args) {
+  InsertBefore(first_, new Node(EmplaceTag(), std::forward<Args>(args)...));
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Erase(BiDirectionalList::Iterator position) {
   if (position.node_ == nullptr) {
     throw std::invalid_argument("trying to erase end()");
   }
   Erase(position.node_);
 }
 
-template<typename T>
-void BiDirectionalList<T>::PopFront() {
+template<typename T, typename Checks>
+size_t BiDirectionalList<T, Checks>::Erase(BiDirectionalList::Iterator first, BiDirectionalList::Iterator last) {
+  if (Checks::kEnabled && (first.list_ != this || last.list_ != this)) {
+    throw std::invalid_argument("Iterator from another list");
+  }
+  if (first.node_ == nullptr && last.node_ != nullptr) {
+    throw std::invalid_argument("range starts at end()");
+  }
+  return EraseSpan(first.node_, last.node_);
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Truncate(size_t count) {
+  if (count < size_) {
+    EraseSpan(NodeAt(count), nullptr);
+  }
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::DropFront(size_t count) {
+  EraseSpan(first_, count < size_ ? NodeAt(count) : nullptr);
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::MoveToFront(BiDirectionalList::Iterator position) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to move end()");
+  }
+  if (position.node_ != first_) {
+    Unlink(position.node_);
+    InsertBefore(first_, position.node_);
+  }
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PopFront() {
   Erase(first_);
 }
 
-template<typename T>
-void BiDirectionalList<T>::PopBack() {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PopBack() {
   Erase(last_);
 }
 
-template<typename T>
-T BiDirectionalList<T>::Front() const {
+template<typename T, typename Checks>
+T BiDirectionalList<T, Checks>::Front() const {
   if (IsEmpty()) {
     throw std::out_of_range("Trying to access front element in empty list");
   }
   return *begin();
 }
 
-template<typename T>
-T BiDirectionalList<T>::Back() const {
+template<typename T, typename Checks>
+T BiDirectionalList<T, Checks>::Back() const {
   if (IsEmpty()) {
     throw std::out_of_range("Trying to access back element in empty list");
   }
   return *(--end());
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::Find(const T& value) {
-  for (auto iterator = begin(); iterator != end(); ++iterator) {
-    if (*iterator == value) {
-      return iterator;
-    }
-  }
-  return end();
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::Find(const T& value) {
+  return FindIf([&value](const T& item) { return item == value; });
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::Find(const T& value) const {
-  for (auto iterator = begin(); iterator != end(); ++iterator) {
-    if (*iterator == value) {
-      return iterator;
-    }
-  }
-  return end();
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::Find(const T& value) const {
+  return FindIf([&value](const T& item) { return item == value; });
 }
 
-template<typename T>
-typename BiDirectionalList<T>::Iterator BiDirectionalList<T>::Find(std::function<bool(const T&)> predicate) {
-  for (auto iterator = begin(); iterator != end(); ++iterator) {
-    if (predicate(*iterator)) {
-      return iterator;
-    }
-  }
-  return end();
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::Find(std::function<bool(const T&)> predicate) {
+  return FindIf(predicate);
 }
 
-template<typename T>
-typename BiDirectionalList<T>::ConstIterator BiDirectionalList<T>::Find(std::function<bool(const T&)> predicate) const {
-  for (auto iterator = begin(); iterator != end(); ++iterator) {
-    if (predicate(*iterator)) {
-      return iterator;
-    }
-  }
-  return end();
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::Find(std::function<bool(const T&)> predicate) const {
+  return FindIf(predicate);
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertBefore(BiDirectionalList::Node* existing_node, BiDirectionalList::Node* new_node) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertBefore(BiDirectionalList::Node* existing_node, BiDirectionalList::Node* new_node) {
+  chunk_starts_valid_ = false;
   if (size_ == 0) {
     first_ = last_ = new_node;
     ++size_;
@@ -515,8 +849,8 @@ void BiDirectionalList<T>::InsertBefore(BiDirectionalList::Node* existing_node,
   ++size_;
 }
 
-template<typename T>
-void BiDirectionalList<T>::InsertAfter(BiDirectionalList::Node* existing_node, BiDirectionalList::Node* new_node) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::InsertAfter(BiDirectionalList::Node* existing_node, BiDirectionalList::Node* new_node) {
   if (existing_node != nullptr) {
     InsertBefore(existing_node->next_node_, new_node);
   } else {
@@ -524,26 +858,433 @@ void BiDirectionalList<T>::InsertAfter(BiDirectionalList::Node* existing_node, B
   }
 }
 
-template<typename T>
-void BiDirectionalList<T>::Erase(BiDirectionalList::Node* node) {
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Erase(BiDirectionalList::Node* node) {
+  Unlink(node);
+  DestroyNode(node);
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::Unlink(BiDirectionalList::Node* node) {
+  chunk_starts_valid_ = false;
   if (size_ == 1) {
-    delete first_;
     first_ = last_ = nullptr;
   } else if (node == first_) {
     first_ = first_->next_node_;
-    delete first_->previous_node_;
     first_->previous_node_ = nullptr;
   } else if (node == last_) {
     last_ = last_->previous_node_;
-    delete last_->next_node_;
     last_->next_node_ = nullptr;
   } else {
     node->previous_node_->next_node_ = node->next_node_;
     node->next_node_->previous_node_ = node->previous_node_;
-    delete node;
   }
+  node->next_node_ = node->previous_node_ = nullptr;
   --size_;
 }
+
+template<typename T, typename Checks>
+size_t BiDirectionalList<T, Checks>::EraseSpan(BiDirectionalList::Node* first, BiDirectionalList::Node* last) {
+  if (first == last) {
+    return 0;
+  }
+  chunk_starts_valid_ = false;
+  Node* before = first->previous_node_;
+  (before != nullptr ? before->next_node_ : first_) = last;
+  (last != nullptr ? last->previous_node_ : last_) = before;
+
+  size_t erased_count = 0;
+  for (Node* node = first; node != last; ++erased_count) {
+    Node* next_node = node->next_node_;
+    DestroyNode(node);
+    node = next_node;
+  }
+  size_ -= erased_count;
+  return erased_count;
+}
+
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Node* BiDirectionalList<T, Checks>::NodeAt(size_t index) const {
+  Node* node;
+  if (index <= size_ / 2) {
+    node = first_;
+    for (size_t i = 0; i < index; ++i) {
+      node = node->next_node_;
+    }
+  } else {
+    node = nullptr;
+    for (size_t i = size_; i > index; --i) {
+      node = (node != nullptr) ? node->previous_node_ : last_;
+    }
+  }
+  return node;
+}
+
+template<typename T, typename Checks>
+template<typename InputIterator>
+void BiDirectionalList<T, Checks>::AppendRange(InputIterator first, InputIterator last, std::input_iterator_tag) {
+  for (; first != last; ++first) {
+    PushBack(*first);
+  }
+}
+
+template<typename T, typename Checks>
+template<typename ForwardIterator>
+void BiDirectionalList<T, Checks>::AppendRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+  AppendBlock(first, static_cast<size_t>(std::distance(first, last)));
+}
+
+template<typename T, typename Checks>
+template<typename ForwardIterator>
+void BiDirectionalList<T, Checks>::AppendBlock(ForwardIterator first, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  // The index entry is reserved first, so that nothing throws once the
+  // nodes are constructed
+  blocks_.reserve(blocks_.size() + 1);
+  Node* nodes = static_cast<Node*>(::operator new(count * sizeof(Node)));
+  size_t constructed_count = 0;
+  try {
+    for (; constructed_count < count; ++constructed_count, ++first) {
+      new (nodes + constructed_count) Node(*first);
+    }
+  } catch (...) {
+    while (constructed_count > 0) {
+      nodes[--constructed_count].~Node();
+    }
+    ::operator delete(nodes);
+    throw;
+  }
+  LinkBlock(nodes, count);
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::LinkBlock(BiDirectionalList::Node* nodes, size_t count) {
+  auto position = std::upper_bound(blocks_.begin(), blocks_.end(), nodes,
+                                   [](const Node* node, const NodeBlock& block) {
+                                     return std::less<const Node*>()(node, block.nodes_);
+                                   });
+  blocks_.insert(position, NodeBlock{nodes, count, count});
+  if (first_ == nullptr) {
+    chunk_starts_.clear();
+    for (size_t i = 0; i < count; i += kChunkSize) {
+      chunk_starts_.push_back(nodes + i);
+    }
+    chunk_starts_valid_ = true;
+  } else {
+    chunk_starts_valid_ = false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    nodes[i].previous_node_ = (i > 0) ? &nodes[i - 1] : last_;
+    nodes[i].next_node_ = (i + 1 < count) ? &nodes[i + 1] : nullptr;
+  }
+  (last_ != nullptr ? last_->next_node_ : first_) = nodes;
+  last_ = nodes + count - 1;
+  size_ += count;
+}
+
+template<typename T, typename Checks>
+const typename BiDirectionalList<T, Checks>::Node* BiDirectionalList<T, Checks>::Advance(const BiDirectionalList::Node* node, size_t steps) {
+  for (; steps > 0 && node != nullptr; --steps) {
+    node = node->next_node_;
+  }
+  return node;
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::PrefetchNext(const BiDirectionalList::Node*& ahead) {
+  if (ahead != nullptr) {
+    ahead = ahead->next_node_;
+#if defined(__GNUC__)
+    __builtin_prefetch(ahead);
+#endif
+  }
+}
+
+template<typename T, typename Checks>
+void BiDirectionalList<T, Checks>::DestroyNode(BiDirectionalList::Node* node) {
+  if (blocks_.empty()) {
+    delete node;
+    return;
+  }
+  // The last block starting at or before the node is the only one
+  // which may contain it
+  std::less<const Node*> less;
+  auto position = std::upper_bound(blocks_.begin(), blocks_.end(), node,
+                                   [less](const Node* address, const NodeBlock& block) {
+                                     return less(address, block.nodes_);
+                                   });
+  if (position == blocks_.begin() || !less(node, (position - 1)->nodes_ + (position - 1)->count_)) {
+    delete node;
+    return;
+  }
+  --position;
+  node->~Node();
+  if (--position->alive_count_ == 0) {
+    ::operator delete(position->nodes_);
+    blocks_.erase(position);
+  }
+}
+
+template<typename T, typename Checks>
+template<typename Predicate>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::FindIf(Predicate predicate) {
+  const Node* ahead = Advance(first_, kPrefetchDistance);
+  Node* node = first_;
+  while (node != nullptr && !predicate(node->value_)) {
+    PrefetchNext(ahead);
+    node = node->next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T, typename Checks>
+template<typename Predicate>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::FindIf(Predicate predicate) const {
+  const Node* ahead = Advance(first_, kPrefetchDistance);
+  Node* node = first_;
+  while (node != nullptr && !predicate(node->value_)) {
+    PrefetchNext(ahead);
+    node = node->next_node_;
+  }
+  return {this, node};
+}
+
+template<typename T, typename Checks>
+template<typename Predicate>
+size_t BiDirectionalList<T, Checks>::CountIf(Predicate predicate) const {
+  size_t count = 0;
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    if (predicate(node->value_)) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+template<typename T, typename Checks>
+template<typename Predicate>
+size_t BiDirectionalList<T, Checks>::RemoveIf(Predicate predicate) {
+  size_t removed_count = 0;
+  Node* node = first_;
+  while (node != nullptr) {
+    Node* next = node->next_node_;
+    if (predicate(node->value_)) {
+      Node* previous = node->previous_node_;
+      if (previous != nullptr) {
+        previous->next_node_ = next;
+      } else {
+        first_ = next;
+      }
+      if (next != nullptr) {
+        next->previous_node_ = previous;
+      } else {
+        last_ = previous;
+      }
+      DestroyNode(node);
+      ++removed_count;
+    }
+    node = next;
+  }
+  size_ -= removed_count;
+  chunk_starts_valid_ = false;
+  return removed_count;
+}
+
+template<typename T, typename Checks>
+template<typename Function>
+void BiDirectionalList<T, Checks>::ForEach(Function function) {
+  for (Node* node = first_; node != nullptr; node = node->next_node_) {
+    function(node->value_);
+  }
+}
+
+template<typename T, typename Checks>
+template<typename Function>
+void BiDirectionalList<T, Checks>::ForEach(Function function) const {
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    function(node->value_);
+  }
+}
+
+template<typename T, typename Checks>
+template<typename Predicate>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::Partition(Predicate predicate) {
+  Node* accepted_first = nullptr;
+  Node* accepted_last = nullptr;
+  Node* rejected_first = nullptr;
+  Node* rejected_last = nullptr;
+
+  Node* node = first_;
+  while (node != nullptr) {
+    Node* next = node->next_node_;
+    if (predicate(node->value_)) {
+      node->previous_node_ = accepted_last;
+      (accepted_last != nullptr ? accepted_last->next_node_ : accepted_first) = node;
+      accepted_last = node;
+    } else {
+      node->previous_node_ = rejected_last;
+      (rejected_last != nullptr ? rejected_last->next_node_ : rejected_first) = node;
+      rejected_last = node;
+    }
+    node = next;
+  }
+
+  if (accepted_last == nullptr) {
+    return begin();
+  }
+  accepted_last->next_node_ = rejected_first;
+  if (rejected_first != nullptr) {
+    rejected_first->previous_node_ = accepted_last;
+    rejected_last->next_node_ = nullptr;
+  }
+  chunk_starts_valid_ = false;
+  first_ = accepted_first;
+  last_ = (rejected_last != nullptr) ? rejected_last : accepted_last;
+  return {this, rejected_first};
+}
+
+template<typename T, typename Checks>
+template<typename Function>
+void BiDirectionalList<T, Checks>::ParallelForEach(Function function, size_t threads_count) {
+  if (!chunk_starts_valid_) {
+    chunk_starts_ = ComputeChunkStarts();
+    chunk_starts_valid_ = true;
+  }
+  RunOnRanges(chunk_starts_, RangesCount(threads_count, chunk_starts_.size()),
+              [&function](Node* first, Node* last, size_t) {
+                for (Node* node = first; node != last; node = node->next_node_) {
+                  function(node->value_);
+                }
+              });
+}
+
+template<typename T, typename Checks>
+template<typename Function>
+void BiDirectionalList<T, Checks>::ParallelForEach(Function function, size_t threads_count) const {
+  const std::vector<Node*> chunk_starts = chunk_starts_valid_ ? chunk_starts_ : ComputeChunkStarts();
+  RunOnRanges(chunk_starts, RangesCount(threads_count, chunk_starts.size()),
+              [&function](const Node* first, const Node* last, size_t) {
+                for (const Node* node = first; node != last; node = node->next_node_) {
+                  function(node->value_);
+                }
+              });
+}
+
+template<typename T, typename Checks>
+template<typename Result, typename Accumulate, typename Combine>
+Result BiDirectionalList<T, Checks>::ParallelReduce(Result identity, Accumulate accumulate, Combine combine,
+                                                    size_t threads_count) const {
+  const std::vector<Node*> chunk_starts = chunk_starts_valid_ ? chunk_starts_ : ComputeChunkStarts();
+  const size_t ranges_count = RangesCount(threads_count, chunk_starts.size());
+  // Every thread writes its own element, so they must not share storage the
+  // way the packed bits of std::vector<bool> do. A thread accumulates in a
+  // local and writes its element once, false sharing doesn't matter then.
+  struct Partial {
+    Result value;
+  };
+  std::vector<Partial> partials(ranges_count, Partial{identity});
+  RunOnRanges(chunk_starts, ranges_count,
+              [&accumulate, &partials](const Node* first, const Node* last, size_t range_index) {
+                Result partial = partials[range_index].value;
+                for (const Node* node = first; node != last; node = node->next_node_) {
+                  partial = accumulate(partial, node->value_);
+                }
+                partials[range_index].value = partial;
+              });
+
+  Result result = identity;
+  for (const Partial& partial : partials) {
+    result = combine(result, partial.value);
+  }
+  return result;
+}
+
+template<typename T, typename Checks>
+std::vector<typename BiDirectionalList<T, Checks>::Node*> BiDirectionalList<T, Checks>::ComputeChunkStarts() const {
+  std::vector<Node*> chunk_starts;
+  chunk_starts.reserve((size_ + kChunkSize - 1) / kChunkSize);
+  size_t index = 0;
+  for (Node* node = first_; node != nullptr; node = node->next_node_, ++index) {
+    if (index % kChunkSize == 0) {
+      chunk_starts.push_back(node);
+    }
+  }
+  return chunk_starts;
+}
+
+template<typename T, typename Checks>
+size_t BiDirectionalList<T, Checks>::RangesCount(size_t threads_count, size_t chunks_count) {
+  if (threads_count == 0) {
+    threads_count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::min(threads_count, chunks_count);
+}
+
+template<typename T, typename Checks>
+template<typename Process>
+void BiDirectionalList<T, Checks>::RunOnRanges(const std::vector<Node*>& chunk_starts, size_t ranges_count,
+                                               Process process) {
+  const size_t chunks_count = chunk_starts.size();
+  std::vector<std::exception_ptr> errors(ranges_count);
+  auto run_range = [&chunk_starts, &errors, &process, chunks_count, ranges_count](size_t range_index) {
+    size_t first_chunk = chunks_count * range_index / ranges_count;
+    size_t last_chunk = chunks_count * (range_index + 1) / ranges_count;
+    try {
+      process(chunk_starts[first_chunk], last_chunk < chunks_count ? chunk_starts[last_chunk] : nullptr,
+              range_index);
+    } catch (...) {
+      errors[range_index] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(ranges_count);
+  try {
+    for (size_t range_index = 0; range_index + 1 < ranges_count; ++range_index) {
+      threads.emplace_back(run_range, range_index);
+    }
+  } catch (...) {
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+  if (ranges_count > 0) {
+    run_range(ranges_count - 1);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Node* BiDirectionalList<T, Checks>::ToNode(BiDirectionalList::Iterator position) {
+  return position.node_;
+}
+
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Node* BiDirectionalList<T, Checks>::ToNode(BiDirectionalList::ConstIterator position) {
+  return const_cast<Node*>(position.node_);
+}
+
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::Iterator BiDirectionalList<T, Checks>::ToIterator(BiDirectionalList::Node* node) {
+  return {this, node};
+}
+
+template<typename T, typename Checks>
+typename BiDirectionalList<T, Checks>::ConstIterator BiDirectionalList<T, Checks>::ToIterator(BiDirectionalList::Node* node) const {
+  return {this, node};
+}
 // |---------------------------------------------------------------------------------------------------|
 // |------------------------------- BiDirectionalList methods declaration -----------------------------|
 // |---------------------------------------------------------------------------------------------------|
@@ -0,0 +1,246 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_LRU_CACHE_H
+#define BIDIRECTIONALLIST_LRU_CACHE_H
+
+// Least recently used cache: a BiDirectionalList keeps the entries in recency
+// order (the front is the most recently used one) and a hash map leads from a
+// key to its node. Get, Put and Erase take O(1) expected time, a hit relinks
+// the node to the front without reallocating it.
+//
+// The capacity is a bound on the total weight of the entries. By default every
+// entry weighs 1, so the capacity is a number of entries; a weigher returning
+// byte sizes turns it into a memory bound. When the bound is exceeded the
+// least recently used entries are evicted, an entry heavier than the whole
+// capacity is evicted right after Put.
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "list.h"
+
+struct LruCacheStats {
+  size_t hits_count;
+  size_t misses_count;
+  size_t evictions_count;
+};
+
+template<typename K, typename V, typename Hash = std::hash<K>>
+class LruCache {
+ public:
+  using Weigher = std::function<size_t(const K&, const V&)>;
+  // Called for every evicted entry, but not for entries erased explicitly
+  using EvictionCallback = std::function<void(const K&, const V&)>;
+
+  // Holds at most 'max_entries' entries
+  explicit LruCache(size_t max_entries);
+  // Holds entries while the sum of weigher(key, value) is at most 'capacity'
+  LruCache(size_t capacity, Weigher weigher);
+
+  LruCache(const LruCache&) = delete;
+  LruCache& operator=(const LruCache&) = delete;
+
+  void SetEvictionCallback(EvictionCallback callback);
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  size_t Capacity() const;
+  size_t Weight() const;
+
+  // Returns nullptr on a miss. On a hit the entry becomes the most recently
+  // used one; the pointer is valid until the entry leaves the cache.
+  V* Get(const K& key);
+
+  // Looks the key up without touching recency and counters
+  bool Contains(const K& key) const;
+
+  // Inserts or replaces the value and makes the entry the most recently used
+  void Put(const K& key, const V& value);
+  void Put(const K& key, V&& value);
+
+  // Returns false if there is no such key
+  bool Erase(const K& key);
+
+  void Clear();
+
+  LruCacheStats Stats() const;
+  void ResetStats();
+
+ private:
+  struct Entry {
+    template<typename U>
+    Entry(const K* key, U&& value, size_t weight) : key_(key), value_(std::forward<U>(value)), weight_(weight) {}
+
+    // Points to the key stored in index_
+    const K* key_;
+    V value_;
+    size_t weight_;
+  };
+
+  using RecencyList = BiDirectionalList<Entry, UncheckedIterators>;
+
+  RecencyList entries_;
+  std::unordered_map<K, typename RecencyList::Iterator, Hash> index_;
+
+  size_t capacity_;
+  size_t weight_;
+  Weigher weigher_;
+  EvictionCallback eviction_callback_;
+  LruCacheStats stats_;
+
+  template<typename U>
+  void PutImpl(const K& key, U&& value);
+
+  void EvictOverweight();
+};
+
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- LruCache methods declaration -----------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename K, typename V, typename Hash>
+LruCache<K, V, Hash>::LruCache(size_t max_entries)
+    : LruCache(max_entries, [](const K&, const V&) -> size_t { return 1; }) {}
+
+template<typename K, typename V, typename Hash>
+LruCache<K, V, Hash>::LruCache(size_t capacity, Weigher weigher)
+    : capacity_(capacity), weight_(0), weigher_(std::move(weigher)), stats_{0, 0, 0} {
+  if (!weigher_) {
+    throw std::invalid_argument("weigher should not be empty");
+  }
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::SetEvictionCallback(EvictionCallback callback) {
+  eviction_callback_ = std::move(callback);
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::IsEmpty() const {
+  return entries_.IsEmpty();
+}
+
+template<typename K, typename V, typename Hash>
+size_t LruCache<K, V, Hash>::Size() const {
+  return entries_.Size();
+}
+
+template<typename K, typename V, typename Hash>
+size_t LruCache<K, V, Hash>::Capacity() const {
+  return capacity_;
+}
+
+template<typename K, typename V, typename Hash>
+size_t LruCache<K, V, Hash>::Weight() const {
+  return weight_;
+}
+
+template<typename K, typename V, typename Hash>
+V* LruCache<K, V, Hash>::Get(const K& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    ++stats_.misses_count;
+    return nullptr;
+  }
+  ++stats_.hits_count;
+  entries_.MoveToFront(found->second);
+  return &found->second->value_;
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::Contains(const K& key) const {
+  return index_.count(key) != 0;
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::Put(const K& key, const V& value) {
+  PutImpl(key, value);
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::Put(const K& key, V&& value) {
+  PutImpl(key, std::move(value));
+}
+
+template<typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::Erase(const K& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return false;
+  }
+  weight_ -= found->second->weight_;
+  entries_.Erase(found->second);
+  index_.erase(found);
+  return true;
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::Clear() {
+  entries_.Clear();
+  index_.clear();
+  weight_ = 0;
+}
+
+template<typename K, typename V, typename Hash>
+LruCacheStats LruCache<K, V, Hash>::Stats() const {
+  return stats_;
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::ResetStats() {
+  stats_ = {0, 0, 0};
+}
+
+template<typename K, typename V, typename Hash>
+template<typename U>
+void LruCache<K, V, Hash>::PutImpl(const K& key, U&& value) {
+  size_t weight = weigher_(key, value);
+
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    Entry& entry = *found->second;
+    entry.value_ = std::forward<U>(value);
+    weight_ = weight_ - entry.weight_ + weight;
+    entry.weight_ = weight;
+    entries_.MoveToFront(found->second);
+  } else {
+    auto inserted = index_.emplace(key, entries_.end()).first;
+    try {
+      entries_.EmplaceFront(&inserted->first, std::forward<U>(value), weight);
+    } catch (...) {
+      index_.erase(inserted);
+      throw;
+    }
+    inserted->second = entries_.begin();
+    weight_ += weight;
+  }
+
+  EvictOverweight();
+}
+
+template<typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::EvictOverweight() {
+  while (weight_ > capacity_) {
+    auto least_recent = --entries_.end();
+    const Entry& entry = *least_recent;
+    if (eviction_callback_) {
+      eviction_callback_(*entry.key_, entry.value_);
+    }
+    weight_ -= entry.weight_;
+    ++stats_.evictions_count;
+    auto found = index_.find(*entry.key_);
+    entries_.Erase(least_recent);
+    index_.erase(found);
+  }
+}
+// |---------------------------------------------------------------------------------------------------|
+// |---------------------------------- LruCache methods declaration -----------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_LRU_CACHE_H
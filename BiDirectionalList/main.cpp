@@ -13,12 +13,15 @@ void TestAll() {
 
   runner.RunTest(TestEmpty, "TestEmpty");
   runner.RunTest(TestAsArrayAndContainerConstructor, "TestAsArrayAndContainerConstructor");
+  runner.RunTest(TestRangeConstructorAndDrain, "TestRangeConstructorAndDrain");
+  runner.RunTest(TestCopyAndMove, "TestCopyAndMove");
   std::cerr << std::endl;
 
   runner.RunTest(TestIterator, "TestIterator");
   runner.RunTest(TestIteratorExceptions, "TestIteratorExceptions");
   runner.RunTest(TestConstIterator, "TestConstIterator");
   runner.RunTest(TestConstIteratorExceptions, "TestConstIteratorExceptions");
+  runner.RunTest(TestUncheckedIterator, "TestUncheckedIterator");
   runner.RunTest(TestForEachCycle, "TestForEachCycle");
   std::cerr << std::endl;
 
@@ -28,8 +31,22 @@ void TestAll() {
 
   runner.RunTest(TestFindValue, "TestFindValue");
   runner.RunTest(TestFindPredicate, "TestFindPredicate");
+  runner.RunTest(TestPredicateAlgorithms, "TestPredicateAlgorithms");
+  runner.RunTest(TestParallelAlgorithms, "TestParallelAlgorithms");
   runner.RunTest(TestErase, "TestErase");
+  runner.RunTest(TestEraseRange, "TestEraseRange");
   runner.RunTest(TestInsertEraseRandomly, "TestInsertEraseRandomly");
+  runner.RunTest(TestCompact, "TestCompact");
+  std::cerr << std::endl;
+
+  runner.RunTest(TestUnrolledList, "TestUnrolledList");
+  runner.RunTest(TestUnrolledListInsertEraseRandomly, "TestUnrolledListInsertEraseRandomly");
+  runner.RunTest(TestIndexedList, "TestIndexedList");
+  runner.RunTest(TestIntrusiveList, "TestIntrusiveList");
+  runner.RunTest(TestConcurrentList, "TestConcurrentList");
+  runner.RunTest(TestCompactList, "TestCompactList");
+  runner.RunTest(TestOrderStatisticsList, "TestOrderStatisticsList");
+  runner.RunTest(TestLruCache, "TestLruCache");
 }
 
 int main() {
@@ -0,0 +1,749 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_ORDER_STATISTICS_LIST_H
+#define BIDIRECTIONALLIST_ORDER_STATISTICS_LIST_H
+
+// BiDirectionalList with a skip-list index layered over its nodes, which gives
+// positional access: At(k), IteratorAt(k), IndexOf(iterator) and
+// InsertAt(k, value) take O(log n) expected time instead of a walk from the
+// front.
+//
+// Every node gets a tower of random height. Level 0 is the ordinary doubly
+// linked list; on every upper level a node links forward and backward to the
+// nearest nodes with a tower that high, and every forward link knows its span,
+// the number of level 0 steps it skips. InsertBefore/InsertAfter/Erase at a
+// known iterator do not search from the front, but they have to fix the spans
+// of the towers covering the node, which is O(log n) expected rather than O(1).
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <utility>
+
+template<typename T>
+class OrderStatisticsList {
+ protected:
+  struct NodeBase;
+  struct Node;
+
+ public:
+  class Iterator : public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    Iterator(const Iterator& other) = default;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    Iterator& operator++();
+    const Iterator operator++(int);
+
+    Iterator& operator--();
+    const Iterator operator--(int);
+
+    Iterator& operator=(const Iterator& other);
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class OrderStatisticsList;
+
+    const OrderStatisticsList* const list_;
+    Node* node_;
+
+    Iterator(const OrderStatisticsList* const list, Node* node)
+        : list_(list), node_(node) {}
+  };
+
+  class ConstIterator :
+      public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    ConstIterator(const ConstIterator& other) = default;
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    ConstIterator& operator++();
+    const ConstIterator operator++(int);
+
+    ConstIterator& operator--();
+    const ConstIterator operator--(int);
+
+    ConstIterator& operator=(const ConstIterator& other);
+    bool operator==(const ConstIterator& other) const;
+    bool operator!=(const ConstIterator& other) const;
+
+   private:
+    friend class OrderStatisticsList;
+
+    const OrderStatisticsList* const list_;
+    const Node* node_;
+
+    ConstIterator(const OrderStatisticsList* const list, const Node* node)
+        : list_(list), node_(node) {}
+  };
+
+  OrderStatisticsList();
+
+  template<typename Container>
+  explicit OrderStatisticsList(const Container&);
+
+  OrderStatisticsList(const OrderStatisticsList&) = delete;
+  OrderStatisticsList& operator=(const OrderStatisticsList&) = delete;
+
+  ~OrderStatisticsList() { Clear(); }
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  void Clear();
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  std::vector<T> AsArray() const;
+
+  // Positional access, O(log n) expected. IteratorAt(Size()) is end(),
+  // IndexOf(end()) is Size().
+  T& At(size_t index);
+  const T& At(size_t index) const;
+
+  Iterator IteratorAt(size_t index);
+  ConstIterator IteratorAt(size_t index) const;
+
+  size_t IndexOf(Iterator position) const;
+  size_t IndexOf(ConstIterator position) const;
+
+  void InsertAt(size_t index, const T& value);
+  void InsertAt(size_t index, T&& value);
+
+  void InsertBefore(Iterator position, const T& value);
+  void InsertBefore(Iterator position, T&& value);
+
+  void InsertAfter(Iterator position, const T& value);
+  void InsertAfter(Iterator position, T&& value);
+
+  void PushBack(const T& value);
+  void PushBack(T&& value);
+
+  void PushFront(const T& value);
+  void PushFront(T&& value);
+
+  void Erase(Iterator position);
+
+  void PopFront();
+  void PopBack();
+
+  T Front() const;
+  T Back() const;
+
+  Iterator Find(const T& value);
+  ConstIterator Find(const T& value) const;
+
+ protected:
+  static const size_t kMaxHeight = 32;
+
+  struct Link {
+    NodeBase* next_node_;
+    NodeBase* previous_node_;
+    // Number of level 0 steps from the owner of the link to next_node_,
+    // the end of the list counts as a step
+    size_t span_;
+  };
+
+  struct NodeBase {
+    size_t height_;
+    Link* links_;
+  };
+
+  // The links of a node are allocated right after it in the same block
+  struct Node : NodeBase {
+    template<typename U>
+    Node(U&& value, size_t height);
+
+    T value_;
+  };
+
+  NodeBase head_;
+  Link head_links_[kMaxHeight];
+  // Number of levels used by at least one node
+  size_t levels_;
+
+  NodeBase* last_;
+  size_t size_;
+
+  std::minstd_rand random_generator_;
+
+  size_t RandomHeight();
+
+  template<typename U>
+  static Node* CreateNode(U&& value, size_t height);
+  static void DestroyNode(Node* node);
+
+  Node* NodeAt(size_t index) const;
+  size_t IndexOf(const NodeBase* node) const;
+
+  // Moves from 'node' to the nearest node at or before it whose tower reaches
+  // 'level', adding the number of skipped level 0 steps to *distance
+  static NodeBase* ClimbTo(NodeBase* node, size_t level, size_t* distance);
+
+  template<typename U>
+  void InsertBefore(Node* existing_node, U&& value);
+  void Erase(Node* node);
+};
+
+template<typename T>
+const size_t OrderStatisticsList<T>::kMaxHeight;
+
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+template<typename T>
+T& OrderStatisticsList<T>::Iterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->value_;
+}
+
+template<typename T>
+T* OrderStatisticsList<T>::Iterator::operator->() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(node_->value_);
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator& OrderStatisticsList<T>::Iterator::operator++() {
+  if (node_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  node_ = static_cast<Node*>(node_->links_[0].next_node_);
+  return *this;
+}
+
+template<typename T>
+const typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::Iterator::operator++(int) {
+  Iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator& OrderStatisticsList<T>::Iterator::operator--() {
+  NodeBase* previous = node_ ? node_->links_[0].previous_node_ : list_->last_;
+  if (previous == &list_->head_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  node_ = static_cast<Node*>(previous);
+  return *this;
+}
+
+template<typename T>
+const typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::Iterator::operator--(int) {
+  Iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator& OrderStatisticsList<T>::Iterator::operator=(const OrderStatisticsList::Iterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  node_ = other.node_;
+  return *this;
+}
+
+template<typename T>
+bool OrderStatisticsList<T>::Iterator::operator==(const OrderStatisticsList::Iterator& other) const {
+  return node_ == other.node_;
+}
+
+template<typename T>
+bool OrderStatisticsList<T>::Iterator::operator!=(const OrderStatisticsList::Iterator& other) const {
+  return node_ != other.node_;
+}
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+
+
+
+
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+template<typename T>
+const T& OrderStatisticsList<T>::ConstIterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->value_;
+}
+
+template<typename T>
+const T* OrderStatisticsList<T>::ConstIterator::operator->() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(node_->value_);
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator& OrderStatisticsList<T>::ConstIterator::operator++() {
+  if (node_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  node_ = static_cast<const Node*>(node_->links_[0].next_node_);
+  return *this;
+}
+
+template<typename T>
+const typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator& OrderStatisticsList<T>::ConstIterator::operator--() {
+  const NodeBase* previous = node_ ? node_->links_[0].previous_node_ : list_->last_;
+  if (previous == &list_->head_) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  node_ = static_cast<const Node*>(previous);
+  return *this;
+}
+
+template<typename T>
+const typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator& OrderStatisticsList<T>::ConstIterator::operator=(const OrderStatisticsList::ConstIterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  node_ = other.node_;
+  return *this;
+}
+
+template<typename T>
+bool OrderStatisticsList<T>::ConstIterator::operator==(const OrderStatisticsList::ConstIterator& other) const {
+  return node_ == other.node_;
+}
+
+template<typename T>
+bool OrderStatisticsList<T>::ConstIterator::operator!=(const OrderStatisticsList::ConstIterator& other) const {
+  return node_ != other.node_;
+}
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+template<typename T>
+template<typename U>
+OrderStatisticsList<T>::Node::Node(U&& value, size_t height) : value_(std::forward<U>(value)) {
+  this->height_ = height;
+  this->links_ = reinterpret_cast<Link*>(this + 1);
+  for (size_t level = 0; level < height; ++level) {
+    new (&this->links_[level]) Link{nullptr, nullptr, 0};
+  }
+}
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------------------------|
+// |------------------------------ OrderStatisticsList methods declaration ----------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T>
+OrderStatisticsList<T>::OrderStatisticsList() : levels_(0), last_(&head_), size_(0), random_generator_(2018) {
+  head_.height_ = kMaxHeight;
+  head_.links_ = head_links_;
+  for (Link& link : head_links_) {
+    link = {nullptr, nullptr, 1};
+  }
+}
+
+template<typename T>
+template<typename Container>
+OrderStatisticsList<T>::OrderStatisticsList(const Container& container) : OrderStatisticsList() {
+  for (const T& item : container) {
+    PushBack(item);
+  }
+}
+
+template<typename T>
+bool OrderStatisticsList<T>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template<typename T>
+size_t OrderStatisticsList<T>::Size() const {
+  return size_;
+}
+
+template<typename T>
+void OrderStatisticsList<T>::Clear() {
+  NodeBase* node = head_links_[0].next_node_;
+  while (node != nullptr) {
+    NodeBase* next_node = node->links_[0].next_node_;
+    DestroyNode(static_cast<Node*>(node));
+    node = next_node;
+  }
+  for (Link& link : head_links_) {
+    link = {nullptr, nullptr, 1};
+  }
+  levels_ = 0;
+  last_ = &head_;
+  size_ = 0;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::begin() {
+  return {this, static_cast<Node*>(head_links_[0].next_node_)};
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::end() {
+  return {this, nullptr};
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::begin() const {
+  return {this, static_cast<const Node*>(head_links_[0].next_node_)};
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::end() const {
+  return {this, nullptr};
+}
+
+template<typename T>
+std::vector<T> OrderStatisticsList<T>::AsArray() const {
+  std::vector<T> array;
+  array.reserve(size_);
+  for (const T& value : *this) {
+    array.push_back(value);
+  }
+  return array;
+}
+
+template<typename T>
+T& OrderStatisticsList<T>::At(size_t index) {
+  if (index >= size_) {
+    throw std::out_of_range("Index is out of list bounds");
+  }
+  return NodeAt(index)->value_;
+}
+
+template<typename T>
+const T& OrderStatisticsList<T>::At(size_t index) const {
+  if (index >= size_) {
+    throw std::out_of_range("Index is out of list bounds");
+  }
+  return NodeAt(index)->value_;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::IteratorAt(size_t index) {
+  if (index > size_) {
+    throw std::out_of_range("Index is out of list bounds");
+  }
+  return {this, index < size_ ? NodeAt(index) : nullptr};
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::IteratorAt(size_t index) const {
+  if (index > size_) {
+    throw std::out_of_range("Index is out of list bounds");
+  }
+  return {this, index < size_ ? NodeAt(index) : nullptr};
+}
+
+template<typename T>
+size_t OrderStatisticsList<T>::IndexOf(OrderStatisticsList::Iterator position) const {
+  if (position.list_ != this) {
+    throw std::invalid_argument("Iterator from another list");
+  }
+  return position.node_ ? IndexOf(position.node_) : size_;
+}
+
+template<typename T>
+size_t OrderStatisticsList<T>::IndexOf(OrderStatisticsList::ConstIterator position) const {
+  if (position.list_ != this) {
+    throw std::invalid_argument("Iterator from another list");
+  }
+  return position.node_ ? IndexOf(position.node_) : size_;
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertAt(size_t index, const T& value) {
+  InsertBefore(IteratorAt(index), value);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertAt(size_t index, T&& value) {
+  InsertBefore(IteratorAt(index), std::move(value));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertBefore(OrderStatisticsList::Iterator position, const T& value) {
+  InsertBefore(position.node_, value);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertBefore(OrderStatisticsList::Iterator position, T&& value) {
+  InsertBefore(position.node_, std::move(value));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertAfter(OrderStatisticsList::Iterator position, const T& value) {
+  InsertBefore(position.node_ ? static_cast<Node*>(position.node_->links_[0].next_node_) : nullptr, value);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::InsertAfter(OrderStatisticsList::Iterator position, T&& value) {
+  InsertBefore(position.node_ ? static_cast<Node*>(position.node_->links_[0].next_node_) : nullptr,
+               std::move(value));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PushBack(const T& value) {
+  InsertBefore(nullptr, value);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PushBack(T&& value) {
+  InsertBefore(nullptr, std::move(value));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PushFront(const T& value) {
+  InsertBefore(static_cast<Node*>(head_links_[0].next_node_), value);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PushFront(T&& value) {
+  InsertBefore(static_cast<Node*>(head_links_[0].next_node_), std::move(value));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::Erase(OrderStatisticsList::Iterator position) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  Erase(position.node_);
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PopFront() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop front element from empty list");
+  }
+  Erase(static_cast<Node*>(head_links_[0].next_node_));
+}
+
+template<typename T>
+void OrderStatisticsList<T>::PopBack() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop back element from empty list");
+  }
+  Erase(static_cast<Node*>(last_));
+}
+
+template<typename T>
+T OrderStatisticsList<T>::Front() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access front element in empty list");
+  }
+  return static_cast<const Node*>(head_links_[0].next_node_)->value_;
+}
+
+template<typename T>
+T OrderStatisticsList<T>::Back() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access back element in empty list");
+  }
+  return static_cast<const Node*>(last_)->value_;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Iterator OrderStatisticsList<T>::Find(const T& value) {
+  for (auto iterator = begin(); iterator != end(); ++iterator) {
+    if (*iterator == value) {
+      return iterator;
+    }
+  }
+  return end();
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::ConstIterator OrderStatisticsList<T>::Find(const T& value) const {
+  for (auto iterator = begin(); iterator != end(); ++iterator) {
+    if (*iterator == value) {
+      return iterator;
+    }
+  }
+  return end();
+}
+
+template<typename T>
+size_t OrderStatisticsList<T>::RandomHeight() {
+  // Every next level is reached with probability 1/2
+  uint32_t bits = static_cast<uint32_t>(random_generator_()) | (1u << (kMaxHeight - 1));
+  size_t height = 1;
+  while ((bits & 1u) == 0) {
+    bits >>= 1;
+    ++height;
+  }
+  return height;
+}
+
+template<typename T>
+template<typename U>
+typename OrderStatisticsList<T>::Node* OrderStatisticsList<T>::CreateNode(U&& value, size_t height) {
+  void* memory = ::operator new(sizeof(Node) + height * sizeof(Link));
+  try {
+    return new (memory) Node(std::forward<U>(value), height);
+  } catch (...) {
+    ::operator delete(memory);
+    throw;
+  }
+}
+
+template<typename T>
+void OrderStatisticsList<T>::DestroyNode(Node* node) {
+  node->~Node();
+  ::operator delete(node);
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::Node* OrderStatisticsList<T>::NodeAt(size_t index) const {
+  // Positions count from the head, so the element 'index' is at index + 1
+  const size_t target = index + 1;
+  const NodeBase* node = &head_;
+  size_t position = 0;
+  for (size_t level = levels_; level-- > 0;) {
+    while (node->links_[level].next_node_ != nullptr && position + node->links_[level].span_ <= target) {
+      position += node->links_[level].span_;
+      node = node->links_[level].next_node_;
+    }
+  }
+  return static_cast<Node*>(const_cast<NodeBase*>(node));
+}
+
+template<typename T>
+size_t OrderStatisticsList<T>::IndexOf(const NodeBase* node) const {
+  size_t position = 0;
+  ClimbTo(const_cast<NodeBase*>(node), levels_, &position);
+  return position - 1;
+}
+
+template<typename T>
+typename OrderStatisticsList<T>::NodeBase* OrderStatisticsList<T>::ClimbTo(NodeBase* node, size_t level, size_t* distance) {
+  while (node->height_ <= level) {
+    Link& top_link = node->links_[node->height_ - 1];
+    NodeBase* previous = top_link.previous_node_;
+    *distance += previous->links_[node->height_ - 1].span_;
+    node = previous;
+  }
+  return node;
+}
+
+template<typename T>
+template<typename U>
+void OrderStatisticsList<T>::InsertBefore(Node* existing_node, U&& value) {
+  size_t height = RandomHeight();
+  Node* new_node = CreateNode(std::forward<U>(value), height);
+
+  for (size_t level = levels_; level < height; ++level) {
+    head_links_[level] = {nullptr, nullptr, size_ + 1};
+  }
+  size_t levels = std::max(levels_, height);
+
+  // Walk up from the level 0 predecessor, keeping the distance to new_node
+  NodeBase* previous = existing_node ? existing_node->links_[0].previous_node_ : last_;
+  size_t distance = 1;
+  for (size_t level = 0; level < levels; ++level) {
+    previous = ClimbTo(previous, level, &distance);
+    Link& link = previous->links_[level];
+    if (level < height) {
+      Link& new_link = new_node->links_[level];
+      new_link.next_node_ = link.next_node_;
+      new_link.previous_node_ = previous;
+      new_link.span_ = link.span_ - distance + 1;
+      if (link.next_node_ != nullptr) {
+        link.next_node_->links_[level].previous_node_ = new_node;
+      }
+      link.next_node_ = new_node;
+      link.span_ = distance;
+    } else {
+      ++link.span_;
+    }
+  }
+
+  if (existing_node == nullptr) {
+    last_ = new_node;
+  }
+  levels_ = levels;
+  ++size_;
+}
+
+template<typename T>
+void OrderStatisticsList<T>::Erase(Node* node) {
+  if (node == last_) {
+    last_ = node->links_[0].previous_node_;
+  }
+
+  NodeBase* previous = node;
+  size_t distance = 0;
+  for (size_t level = 0; level < levels_; ++level) {
+    if (level < node->height_) {
+      Link& erased_link = node->links_[level];
+      previous = erased_link.previous_node_;
+      Link& link = previous->links_[level];
+      link.next_node_ = erased_link.next_node_;
+      link.span_ += erased_link.span_ - 1;
+      if (erased_link.next_node_ != nullptr) {
+        erased_link.next_node_->links_[level].previous_node_ = previous;
+      }
+    } else {
+      previous = ClimbTo(previous, level, &distance);
+      --previous->links_[level].span_;
+    }
+  }
+
+  DestroyNode(node);
+  --size_;
+}
+// |---------------------------------------------------------------------------------------------------|
+// |------------------------------ OrderStatisticsList methods declaration ----------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_ORDER_STATISTICS_LIST_H
@@ -7,10 +7,24 @@
 #include <chrono>
 #include <deque>
 #include <list>
+#include <memory>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <numeric>
+#include <type_traits>
+#include <sstream>
+#include <type_traits>
 
 #include "testing_framework.h"
 #include "list.h"
+#include "unrolled_list.h"
+#include "indexed_list.h"
+#include "intrusive_list.h"
+#include "concurrent_list.h"
+#include "compact_list.h"
+#include "order_statistics_list.h"
+#include "lru_cache.h"
 #include "tests.h"
 
 // struct for testing
@@ -31,6 +45,13 @@ std::ostream& operator<<(std::ostream& output, const Point& point) {
   return output;
 }
 
+struct ActiveConnectionsTag {};
+
+struct Connection : IntrusiveListHook<>, IntrusiveListHook<ActiveConnectionsTag> {
+  explicit Connection(int id) : id(id) {}
+  int id;
+};
+
 class RandomIntGenerator {
  public:
   RandomIntGenerator(int left, int right, long long seed =
@@ -96,6 +117,11 @@ void TestEmpty() {
   list.PushFront(42);
   list.PopBack();
   Assert(list.IsEmpty(), "PushFront, PopBack -> expected empty");
+
+  BiDirectionalList<std::string> strings;
+  strings.EmplaceBack(3, 'b');
+  strings.EmplaceFront("a");
+  AssertEqual(strings.AsArray(), std::vector<std::string>{"a", "bbb"}, "EmplaceBack/EmplaceFront work wrong");
 }
 
 void TestAsArrayAndContainerConstructor() {
@@ -121,6 +147,123 @@ void TestAsArrayAndContainerConstructor() {
   AssertEqual(BiDirectionalList<int>{}.AsArray(), std::vector<int>{}, as_array_fault_toast);
 };
 
+// Copying the third instance throws
+struct ThrowingOnCopy {
+  static int copies_count;
+
+  ThrowingOnCopy() = default;
+  ThrowingOnCopy(const ThrowingOnCopy&) {
+    if (++copies_count == 3) {
+      throw std::runtime_error("copy failed");
+    }
+  }
+};
+
+int ThrowingOnCopy::copies_count = 0;
+
+void TestRangeConstructorAndDrain() {
+  const std::string fault_toast = "range constructor doesn't work";
+
+  std::vector<int> int_vec(1'000);
+  std::iota(int_vec.begin(), int_vec.end(), 0);
+  BiDirectionalList<int> int_list(int_vec.begin() + 10, int_vec.end());
+  AssertEqual(int_list.AsArray(), std::vector<int>(int_vec.begin() + 10, int_vec.end()), fault_toast);
+  AssertEqual(int_list.AsArray().capacity(), int_list.Size(), "AsArray should reserve exactly Size()");
+
+  std::list<std::string> string_std_list{"a", "bb", "ccc"};
+  BiDirectionalList<std::string> string_list(string_std_list.begin(), string_std_list.end());
+  AssertEqual(string_list.AsArray(), std::vector<std::string>{"a", "bb", "ccc"}, fault_toast);
+
+  std::istringstream input("4 8 15 16 23 42");
+  BiDirectionalList<int> input_list{std::istream_iterator<int>(input), std::istream_iterator<int>()};
+  AssertEqual(input_list.AsArray(), std::vector<int>({4, 8, 15, 16, 23, 42}), fault_toast);
+
+  // Block nodes are mixed with separately allocated ones and erased one by one
+  std::vector<int> vec(int_vec.begin() + 10, int_vec.end());
+  RandomIntGenerator generator(0, 1'000'000);
+  for (int i = 0; i < 2'000; ++i) {
+    int index = vec.empty() ? 0 : generator.NextInt() % vec.size();
+    auto iterator = int_list.begin();
+    for (int j = 0; j < index; ++j) {
+      ++iterator;
+    }
+    if (i % 3 == 0) {
+      int_list.InsertBefore(iterator, i);
+      vec.insert(vec.begin() + index, i);
+    } else if (!vec.empty()) {
+      int_list.Erase(iterator);
+      vec.erase(vec.begin() + index);
+    }
+  }
+  AssertEqual(int_list.AsArray(), vec, fault_toast);
+
+  std::vector<std::string> drained = string_list.DrainToVector();
+  AssertEqual(drained, std::vector<std::string>{"a", "bb", "ccc"}, "DrainToVector works wrong");
+  Assert(string_list.IsEmpty() && string_list.begin() == string_list.end(), "list should be empty after drain");
+  string_list.PushBack("d");
+  AssertEqual(string_list.AsArray(), std::vector<std::string>{"d"}, "list should be usable after drain");
+  AssertEqual(BiDirectionalList<int>{}.DrainToVector(), std::vector<int>{}, "DrainToVector works wrong");
+
+  std::vector<ThrowingOnCopy> throwing_vec(5);
+  try {
+    BiDirectionalList<ThrowingOnCopy> throwing_list(throwing_vec.begin(), throwing_vec.end());
+    throw std::logic_error("range constructor should rethrow an exception from a copy");
+  } catch (const std::runtime_error& ex) {
+    // everything is correct
+  }
+}
+
+void TestCopyAndMove() {
+  const std::string fault_toast = "copy or move of a list works wrong";
+  static_assert(std::is_nothrow_move_constructible<BiDirectionalList<std::string>>::value,
+                "move constructor should be noexcept");
+  static_assert(std::is_nothrow_move_assignable<BiDirectionalList<std::string>>::value,
+                "move assignment should be noexcept");
+
+  std::vector<std::string> vec{"a", "b", "c", "d"};
+  BiDirectionalList<std::string> list(vec);
+  list.PushFront("front");
+  vec.insert(vec.begin(), "front");
+
+  BiDirectionalList<std::string> copy(list);
+  AssertEqual(copy.AsArray(), vec, fault_toast);
+  copy.PopBack();
+  *copy.begin() = "changed";
+  AssertEqual(list.AsArray(), vec, "copy should not share nodes with the source");
+
+  // Copy assignment to a shorter, a longer and an equally long list
+  for (size_t size : {0u, 2u, 5u, 9u}) {
+    BiDirectionalList<std::string> assigned(std::vector<std::string>(size, "old"));
+    assigned = list;
+    AssertEqual(assigned.AsArray(), vec, fault_toast);
+    AssertEqual(assigned.Size(), vec.size(), fault_toast);
+    AssertEqual(*(--assigned.end()), vec.back(), fault_toast);
+    assigned.PushBack("back");
+    AssertEqual(assigned.Back(), std::string("back"), fault_toast);
+  }
+  BiDirectionalList<std::string> emptied(list);
+  emptied = BiDirectionalList<std::string>();
+  Assert(emptied.IsEmpty() && emptied.begin() == emptied.end(), fault_toast);
+  const BiDirectionalList<std::string>& same_list = list;
+  list = same_list;
+  AssertEqual(list.AsArray(), vec, "self assignment should keep the list");
+
+  BiDirectionalList<std::string> moved(std::move(copy));
+  Assert(copy.IsEmpty() && copy.begin() == copy.end(), "moved-from list should be empty");
+  AssertEqual(moved.Size(), vec.size() - 1, fault_toast);
+  copy.PushBack("reused");
+  AssertEqual(copy.AsArray(), std::vector<std::string>{"reused"}, "moved-from list should be usable");
+
+  moved = std::move(list);
+  AssertEqual(moved.AsArray(), vec, fault_toast);
+  Assert(list.IsEmpty(), "moved-from list should be empty");
+
+  IndexedBiDirectionalList<int> indexed(std::vector<int>{1, 2, 3});
+  IndexedBiDirectionalList<int> moved_indexed(std::move(indexed));
+  Assert(moved_indexed.Contains(2) && moved_indexed.Erase(2), fault_toast);
+  AssertEqual(moved_indexed.AsArray(), std::vector<int>({1, 3}), fault_toast);
+}
+
 void TestIterator() {
   BiDirectionalList<int> list(std::vector<int>{4, 5, 2, 0, 42, 24});
   AssertEqual(*list.begin(), 4, "Wrong begin iterator");
@@ -253,6 +396,25 @@ void TestConstIteratorExceptions() {
   AssertEqual(point_it->y, -2, "");
 }
 
+void TestUncheckedIterator() {
+  BiDirectionalList<int, UncheckedIterators> list(std::vector<int>{4, 5, 2, 0, 42, 24});
+  AssertEqual(*list.begin(), 4, "Wrong begin iterator");
+  AssertEqual(*(--list.end()), 24, "Wrong end iterator");
+  AssertEqual(list.Back(), 24, "Wrong Back");
+
+  std::vector<int> result;
+  for (auto it = list.begin(); it != list.end(); it++) {
+    result.push_back(*it);
+  }
+  AssertEqual(result, list.AsArray(), "unchecked iteration works wrong");
+
+  const auto& const_list = list;
+  auto it = const_list.end();
+  it--;
+  --it;
+  AssertEqual(*it, 42, "Prefix decrement works wrong");
+}
+
 void TestForEachCycle() {
   BiDirectionalList<uint8_t> list(std::vector<uint8_t>{0, 32, 123, 23, 253});
   std::vector<uint8_t> result;
@@ -360,6 +522,15 @@ void FillIntEqualContainers(BiDirectionalList<int>& best_list, Container& correc
   }
 }
 
+template<typename List>
+int IndexOf(List& list, typename List::Iterator position) {
+  int index = 0;
+  for (auto iterator = list.begin(); iterator != position; ++iterator) {
+    ++index;
+  }
+  return index;
+}
+
 void TestFindValue() {
   const std::string fault_toast = "Find method works wrong";
   RandomIntGenerator generator(1, 200);
@@ -431,6 +602,138 @@ void TestFindPredicate() {
   }
 }
 
+void TestPredicateAlgorithms() {
+  const std::string fault_toast = "predicate algorithms work wrong";
+  RandomIntGenerator generator(1, 200);
+
+  BiDirectionalList<int> best_list;
+  std::list<int> correct_list;
+  FillIntEqualContainers(best_list, correct_list, generator, 500);
+
+  for (int divisor = 2; divisor < 40; ++divisor) {
+    auto is_divisible = [divisor](int x) { return x % divisor == 0; };
+
+    auto best_list_pos = best_list.FindIf(is_divisible);
+    auto correct_list_pos = std::find_if(correct_list.begin(), correct_list.end(), is_divisible);
+    Assert((best_list_pos == best_list.end()) == (correct_list_pos == correct_list.end()), fault_toast);
+    if (correct_list_pos != correct_list.end()) {
+      AssertEqual(*best_list_pos, *correct_list_pos, fault_toast);
+      AssertEqual(IndexOf(best_list, best_list_pos),
+                  static_cast<int>(std::distance(correct_list.begin(), correct_list_pos)), fault_toast);
+    }
+
+    AssertEqual(best_list.CountIf(is_divisible),
+                static_cast<size_t>(std::count_if(correct_list.begin(), correct_list.end(), is_divisible)),
+                fault_toast);
+  }
+
+  long long best_sum = 0;
+  const auto& const_list = best_list;
+  const_list.ForEach([&best_sum](const int& x) { best_sum += x; });
+  AssertEqual(best_sum, std::accumulate(correct_list.begin(), correct_list.end(), 0LL), fault_toast);
+
+  best_list.ForEach([](int& x) { x *= 3; });
+  for (int& x : correct_list) {
+    x *= 3;
+  }
+  AssertEqual(best_list.AsArray(),
+              ContainerAsArray<std::list<int>::iterator, int>(correct_list.begin(), correct_list.end()),
+              fault_toast);
+
+  auto is_odd = [](int x) { return x % 2 != 0; };
+  auto best_list_middle = best_list.Partition(is_odd);
+  auto correct_list_middle = std::stable_partition(correct_list.begin(), correct_list.end(), is_odd);
+  AssertEqual(best_list.AsArray(),
+              ContainerAsArray<std::list<int>::iterator, int>(correct_list.begin(), correct_list.end()),
+              "Partition works wrong");
+  AssertEqual(IndexOf(best_list, best_list_middle),
+              static_cast<int>(std::distance(correct_list.begin(), correct_list_middle)),
+              "Partition returned wrong iterator");
+  AssertEqual(*(--best_list.end()), correct_list.back(), "Partition broke last element");
+
+  auto is_small = [](int x) { return x < 150; };
+  size_t removed_count = best_list.RemoveIf(is_small);
+  size_t correct_size = correct_list.size();
+  correct_list.remove_if(is_small);
+  AssertEqual(removed_count, correct_size - correct_list.size(), "RemoveIf returned wrong count");
+  AssertEqual(best_list.Size(), correct_list.size(), "RemoveIf works wrong");
+  AssertEqual(best_list.AsArray(),
+              ContainerAsArray<std::list<int>::iterator, int>(correct_list.begin(), correct_list.end()),
+              "RemoveIf works wrong");
+
+  AssertEqual(best_list.RemoveIf([](int) { return true; }), correct_list.size(), "RemoveIf works wrong");
+  Assert(best_list.IsEmpty() && best_list.begin() == best_list.end(), "RemoveIf should empty the list");
+  Assert(best_list.Partition(is_odd) == best_list.end(), "Partition of empty list works wrong");
+  best_list.PushBack(5);
+  AssertEqual(best_list.Back(), 5, "list is broken after RemoveIf");
+}
+
+void TestParallelAlgorithms() {
+  const std::string fault_toast = "parallel algorithms work wrong";
+
+  std::vector<long long> vec(20'000);
+  std::iota(vec.begin(), vec.end(), 0);
+  BiDirectionalList<long long> list(vec);
+  for (size_t threads_count : {1u, 2u, 3u, 8u, 0u}) {
+    list.ParallelForEach([](long long& x) { x *= 2; }, threads_count);
+    for (long long& x : vec) {
+      x *= 2;
+    }
+    AssertEqual(list.AsArray(), vec, fault_toast);
+    AssertEqual(list.ParallelReduce(0LL, std::plus<long long>(), std::plus<long long>(), threads_count),
+                std::accumulate(vec.begin(), vec.end(), 0LL), fault_toast);
+  }
+
+  // Boundaries are recomputed after the list is relinked
+  auto middle = list.begin();
+  for (int i = 0; i < 5'000; ++i) {
+    ++middle;
+  }
+  for (int i = 0; i < 3'000; ++i) {
+    list.InsertBefore(middle, 1);
+  }
+  list.DropFront(100);
+  const BiDirectionalList<long long>& const_list = list;
+  long long count = const_list.ParallelReduce(0LL, [](long long partial, long long) { return partial + 1; },
+                                              std::plus<long long>(), 4);
+  AssertEqual(static_cast<size_t>(count), list.Size(), fault_toast);
+  std::atomic<long long> sum(0);
+  const_list.ParallelForEach([&sum](long long x) { sum += x; }, 4);
+  AssertEqual(sum.load(), std::accumulate(list.begin(), list.end(), 0LL), fault_toast);
+
+  // Partial results are combined in list order
+  std::vector<std::string> words(10'000);
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = std::to_string(i % 10);
+  }
+  BiDirectionalList<std::string> word_list(words);
+  auto concatenate = [](const std::string& left, const std::string& right) { return left + right; };
+  AssertEqual(word_list.ParallelReduce(std::string(), concatenate, concatenate, 3),
+              std::accumulate(words.begin(), words.end(), std::string()), fault_toast);
+
+  // Partial results of type bool are written by several threads at once
+  auto any_negative = [](bool partial, long long x) { return partial || x < 0; };
+  auto logical_or = [](bool left, bool right) { return left || right; };
+  for (int i = 0; i < 100; ++i) {
+    Assert(!const_list.ParallelReduce(false, any_negative, logical_or, 8), fault_toast);
+  }
+  list.PushBack(-1);
+  Assert(list.ParallelReduce(false, any_negative, logical_or, 8), fault_toast);
+
+  BiDirectionalList<int> empty_list;
+  AssertEqual(empty_list.ParallelReduce(42, std::plus<int>(), std::plus<int>()), 42, fault_toast);
+  try {
+    list.ParallelForEach([](long long x) {
+      if (x == 1) {
+        throw std::invalid_argument("worker failed");
+      }
+    }, 4);
+    throw std::runtime_error("ParallelForEach should rethrow an exception from a worker");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+}
+
 void TestErase() {
   const std::string fault_toast = "Erase method works wrong";
   RandomIntGenerator generator(1, 500);
@@ -486,6 +789,67 @@ void TestErase() {
   }
 }
 
+void TestEraseRange() {
+  const std::string fault_toast = "range erase works wrong";
+  RandomIntGenerator generator(0, 1'000'000);
+
+  for (int i = 0; i < 300; ++i) {
+    std::vector<int> vec(generator.NextInt() % 50);
+    std::iota(vec.begin(), vec.end(), 0);
+    BiDirectionalList<int> list(vec);
+    if (i % 2 == 0) {
+      list.PushFront(-1);
+      vec.insert(vec.begin(), -1);
+    }
+
+    size_t first_index = generator.NextInt() % (vec.size() + 1);
+    size_t last_index = first_index + generator.NextInt() % (vec.size() - first_index + 1);
+    auto first = list.begin();
+    for (size_t j = 0; j < first_index; ++j) {
+      ++first;
+    }
+    auto last = first;
+    for (size_t j = first_index; j < last_index; ++j) {
+      ++last;
+    }
+    AssertEqual(list.Erase(first, last), last_index - first_index, fault_toast);
+    vec.erase(vec.begin() + first_index, vec.begin() + last_index);
+    AssertEqual(list.AsArray(), vec, fault_toast);
+    AssertEqual(list.Size(), vec.size(), fault_toast);
+    if (!vec.empty()) {
+      AssertEqual(*(--list.end()), vec.back(), fault_toast);
+      AssertEqual(list.Front(), vec.front(), fault_toast);
+    }
+  }
+
+  std::vector<int> log(100);
+  std::iota(log.begin(), log.end(), 0);
+  BiDirectionalList<int> log_list(log);
+  log_list.DropFront(10);
+  log_list.Truncate(80);
+  log_list.Truncate(1'000);
+  AssertEqual(log_list.AsArray(), std::vector<int>(log.begin() + 10, log.begin() + 90), "DropFront or Truncate works wrong");
+  log_list.DropFront(1'000);
+  Assert(log_list.IsEmpty() && log_list.begin() == log_list.end(), "DropFront should erase everything");
+  log_list.PushBack(1);
+  log_list.Truncate(0);
+  Assert(log_list.IsEmpty(), "Truncate(0) should erase everything");
+
+  BiDirectionalList<int> other_list(log);
+  try {
+    other_list.Erase(other_list.end(), other_list.begin());
+    throw std::runtime_error("erase should throw an exception for a range from end()");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+  try {
+    other_list.Erase(other_list.begin(), log_list.end());
+    throw std::runtime_error("erase should throw an exception for a range from another list");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+}
+
 void TestInsertEraseRandomly() {
   RandomIntGenerator value_generator(-1'000'000'000, 1'000'000'000);
 
@@ -521,4 +885,860 @@ void TestInsertEraseRandomly() {
     }
     AssertEqual(list.AsArray(), ContainerAsArray<std::vector<int>::iterator, int>(vec.begin(), vec.end()), "Insert method work's wrong");
   }
-}
\ No newline at end of file
+}
+
+void TestCompact() {
+  const std::string fault_toast = "Compact works wrong";
+  RandomIntGenerator generator(0, 1'000'000);
+
+  std::vector<int> vec{0, 1, 2, 3, 4};
+  BiDirectionalList<int> list(vec);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1'000; ++i) {
+      int index = vec.empty() ? 0 : generator.NextInt() % vec.size();
+      auto iterator = list.begin();
+      for (int j = 0; j < index; ++j) {
+        ++iterator;
+      }
+      if (i % 3 != 2 || vec.empty()) {
+        list.InsertBefore(iterator, i);
+        vec.insert(vec.begin() + index, i);
+      } else {
+        list.Erase(iterator);
+        vec.erase(vec.begin() + index);
+      }
+    }
+    list.Compact();
+    AssertEqual(list.AsArray(), vec, fault_toast);
+    AssertEqual(list.Size(), vec.size(), fault_toast);
+    AssertEqual(*(--list.end()), vec.back(), fault_toast);
+  }
+
+  // Nodes of a compacted list are adjacent in list order
+  auto iterator = list.begin();
+  const int* previous = &*iterator;
+  for (++iterator; iterator != list.end(); ++iterator) {
+    Assert(&*iterator > previous, "compacted nodes should go in address order");
+    previous = &*iterator;
+  }
+  Assert(list.Find(vec[vec.size() / 2]) != list.end(), fault_toast);
+  Assert(list.Find(-1) == list.end(), fault_toast);
+
+  // Growing assignments append a block each, pushed nodes are separate;
+  // erasing them in mixed order releases every block exactly once
+  const BiDirectionalList<int> five(std::vector<int>{0, 1, 2, 3, 4});
+  const BiDirectionalList<int> nine(std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8});
+  BiDirectionalList<int> blocks(std::vector<int>{0, 1});
+  blocks = five;
+  blocks.PushBack(5);
+  blocks = nine;
+  blocks.PushFront(-1);
+  std::vector<int> expected{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+  for (size_t step : {3u, 0u, 5u, 1u, 2u, 4u, 0u, 1u, 1u, 0u}) {
+    auto position = blocks.begin();
+    for (size_t j = 0; j < step; ++j) {
+      ++position;
+    }
+    blocks.Erase(position);
+    expected.erase(expected.begin() + step);
+    AssertEqual(blocks.AsArray(), expected, fault_toast);
+  }
+  Assert(blocks.IsEmpty(), fault_toast);
+
+  BiDirectionalList<std::string> strings(std::vector<std::string>{"a", "b"});
+  strings.PushFront("c");
+  strings.Compact();
+  AssertEqual(strings.AsArray(), std::vector<std::string>{"c", "a", "b"}, fault_toast);
+  strings.Clear();
+  strings.Compact();
+  Assert(strings.IsEmpty(), fault_toast);
+}
+
+void TestUnrolledList() {
+  UnrolledList<int, 4> list;
+  Assert(list.IsEmpty(), "unrolled list should be empty");
+
+  std::vector<int> vec;
+  for (int i = 0; i < 30; ++i) {
+    list.PushBack(i);
+    vec.push_back(i);
+  }
+  for (int i = -1; i > -30; --i) {
+    list.PushFront(i);
+    vec.insert(vec.begin(), i);
+  }
+  AssertEqual(list.AsArray(), vec, "PushBack/PushFront work wrong");
+  AssertEqual(list.Size(), vec.size(), "wrong size");
+  AssertEqual(list.Front(), -29, "wrong Front");
+  AssertEqual(list.Back(), 29, "wrong Back");
+
+  std::vector<int> reversed;
+  auto it = list.end();
+  while (it != list.begin()) {
+    reversed.push_back(*(--it));
+  }
+  std::reverse(reversed.begin(), reversed.end());
+  AssertEqual(reversed, vec, "reverse iteration works wrong");
+
+  AssertEqual(*list.Find(17), 17, "Find method works wrong");
+  Assert(list.Find(100) == list.end(), "Find method works wrong");
+  AssertEqual(*list.Find([](const int& x) { return x > 20; }), 21, "Find method works wrong");
+
+  try {
+    *list.end();
+    throw std::runtime_error("operator* from end() should throw an exception");
+  } catch (const std::invalid_argument& ex) {
+    // everything work correct
+  }
+  try {
+    --list.begin();
+    throw std::runtime_error("decrement of begin() should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything work correct
+  }
+  try {
+    list.Erase(list.end());
+    throw std::runtime_error("erase should throw an exception after invocation from end()");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+
+  while (!list.IsEmpty()) {
+    list.PopFront();
+    if (!list.IsEmpty()) {
+      list.PopBack();
+    }
+  }
+  Assert(list.begin() == list.end(), "begin() != end() in empty list");
+  try {
+    list.PopBack();
+    throw std::runtime_error("pop from empty list should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+
+  const UnrolledList<Point> point_list(std::vector<Point>{{1, 2}, {10, 66}, {-6, 42}});
+  AssertEqual((++point_list.begin())->y, 66, "operator-> works wrong");
+
+  // Inserted values referring to elements of the same list
+  UnrolledList<std::string, 4> strings(std::vector<std::string>{"a", "b", "c"});
+  strings.InsertBefore(strings.begin(), *std::next(strings.begin()));
+  AssertEqual(strings.AsArray(), std::vector<std::string>{"b", "a", "b", "c"}, "insert of own element works wrong");
+  strings.InsertAfter(strings.begin(), *std::prev(strings.end()));
+  AssertEqual(strings.AsArray(), std::vector<std::string>{"b", "c", "a", "b", "c"},
+              "insert of own element into a full node works wrong");
+
+  // Inserts in front of a full node fill up the previous node: [0, 3] [4, 5, 6, 7]
+  UnrolledList<int, 4> dense_list(std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+  dense_list.Erase(std::next(dense_list.begin()));
+  dense_list.Erase(std::next(dense_list.begin()));
+  for (int value : {10, 20}) {
+    dense_list.InsertBefore(dense_list.Find(4), value);
+  }
+  AssertEqual(dense_list.AsArray(), std::vector<int>{0, 3, 10, 20, 4, 5, 6, 7}, "insert before a full node works wrong");
+  AssertEqual(&*dense_list.Find(20) - &*dense_list.begin(), 3, "insert before a full node should use the previous one");
+
+  ThrowingOnCopy::copies_count = -100;
+  UnrolledList<ThrowingOnCopy, 4> throwing_list;
+  for (int i = 0; i < 3; ++i) {
+    throwing_list.PushBack(ThrowingOnCopy());
+  }
+  ThrowingOnCopy::copies_count = 2;
+  try {
+    throwing_list.InsertBefore(std::next(throwing_list.begin()), ThrowingOnCopy());
+    throw std::logic_error("insert should rethrow an exception from a copy");
+  } catch (const std::runtime_error& ex) {
+    AssertEqual(throwing_list.Size(), 3u, "failed insert should leave the list unchanged");
+  }
+  ThrowingOnCopy::copies_count = 0;
+}
+
+void TestUnrolledListInsertEraseRandomly() {
+  RandomIntGenerator value_generator(-1'000'000'000, 1'000'000'000);
+
+  UnrolledList<int, 4> list;
+  std::vector<int> vec;
+  for (int i = 0; i < 200; ++i) {
+    int value = value_generator.NextInt();
+    list.PushBack(value);
+    vec.push_back(value);
+  }
+
+  RandomIntGenerator action_generator(0, 2);
+  for (int i = 0; i < 2'000 && !vec.empty(); ++i) {
+    int iterator_index = abs(value_generator.NextInt()) % vec.size();
+    auto iterator = list.begin();
+    for (int j = 0; j < iterator_index; ++j) {
+      ++iterator;
+    }
+
+    InsertEraseMethods method_name = static_cast<InsertEraseMethods>(action_generator.NextInt());
+    switch (method_name) {
+      case InsertEraseMethods::INSERT_AFTER: {
+        int value = value_generator.NextInt();
+        list.InsertAfter(iterator, value);
+        vec.insert(vec.begin() + iterator_index + 1, value);
+        break;
+      }
+      case InsertEraseMethods::INSERT_BEFORE: {
+        int value = value_generator.NextInt();
+        list.InsertBefore(iterator, value);
+        vec.insert(vec.begin() + iterator_index, value);
+        break;
+      }
+      case InsertEraseMethods::ERASE: {
+        list.Erase(iterator);
+        vec.erase(vec.begin() + iterator_index);
+        break;
+      }
+      default: throw std::runtime_error("Action generator provided wrong number.");
+    }
+    AssertEqual(list.AsArray(), vec, "UnrolledList insert/erase works wrong");
+    AssertEqual(list.Size(), vec.size(), "UnrolledList size is wrong");
+  }
+}
+
+// Hashing kThrowingValue throws
+struct ThrowingOnValueHash {
+  static const int kThrowingValue = -1;
+
+  size_t operator()(int value) const {
+    if (value == kThrowingValue) {
+      throw std::runtime_error("hash failed");
+    }
+    return std::hash<int>()(value);
+  }
+};
+
+const int ThrowingOnValueHash::kThrowingValue;
+
+void TestIndexedList() {
+  const std::string fault_toast = "IndexedBiDirectionalList works wrong";
+  static_assert(std::is_same<decltype(std::declval<IndexedBiDirectionalList<int>&>().begin()),
+                             IndexedBiDirectionalList<int>::ConstIterator>::value,
+                "IndexedBiDirectionalList must not hand out mutable iterators");
+  RandomIntGenerator value_generator(1, 300);
+  RandomIntGenerator action_generator(0, 5);
+
+  IndexedBiDirectionalList<int> list(std::vector<int>{5, 7, 5});
+  std::vector<int> vec{5, 7, 5};
+
+  for (int i = 0; i < 3'000; ++i) {
+    int value = value_generator.NextInt();
+    switch (action_generator.NextInt()) {
+      case 0: {
+        list.PushBack(value);
+        vec.push_back(value);
+        break;
+      }
+      case 1: {
+        list.PushFront(value);
+        vec.insert(vec.begin(), value);
+        break;
+      }
+      case 2: {
+        auto position = list.Find(value);
+        if (position != list.end()) {
+          AssertEqual(*position, value, fault_toast);
+          vec.insert(vec.begin() + IndexOf(list, position) + 1, value + 1);
+          list.InsertAfter(position, value + 1);
+        }
+        break;
+      }
+      case 3: {
+        // Any of the equal values may be erased, so check the multisets
+        // and take the resulting order from the list
+        bool erased = list.Erase(value);
+        auto vec_position = std::find(vec.begin(), vec.end(), value);
+        AssertEqual(erased, vec_position != vec.end(), fault_toast);
+        if (erased) {
+          vec.erase(vec_position);
+          std::vector<int> list_values = list.AsArray();
+          std::sort(list_values.begin(), list_values.end());
+          std::sort(vec.begin(), vec.end());
+          AssertEqual(list_values, vec, fault_toast);
+          vec = list.AsArray();
+        }
+        break;
+      }
+      case 4: {
+        if (!vec.empty()) {
+          list.PopBack();
+          vec.pop_back();
+        }
+        break;
+      }
+      case 5: {
+        auto position = list.Find(value);
+        if (position != list.end()) {
+          vec.erase(vec.begin() + IndexOf(list, position));
+          list.Erase(position);
+        }
+        break;
+      }
+      default: throw std::runtime_error("Action generator provided wrong number.");
+    }
+
+    AssertEqual(list.AsArray(), vec, fault_toast);
+    int probe = value_generator.NextInt();
+    AssertEqual(list.Contains(probe), std::find(vec.begin(), vec.end(), probe) != vec.end(), fault_toast);
+  }
+
+  list.Clear();
+  Assert(!list.Contains(5) && list.IsEmpty(), "Clear should empty the index");
+
+  // A failed insert into the index leaves the list unchanged
+  IndexedBiDirectionalList<int, ThrowingOnValueHash> throwing_list(std::vector<int>{1, 2});
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    try {
+      if (attempt == 0) {
+        throwing_list.PushBack(ThrowingOnValueHash::kThrowingValue);
+      } else {
+        throwing_list.InsertAfter(throwing_list.begin(), ThrowingOnValueHash::kThrowingValue);
+      }
+      throw std::logic_error("insert should rethrow an exception from the hash");
+    } catch (const std::runtime_error& ex) {
+      AssertEqual(throwing_list.AsArray(), std::vector<int>{1, 2}, "failed insert should leave the list unchanged");
+    }
+  }
+  Assert(list.IndexMemoryUsage() > 0, "index memory usage should be reported");
+  try {
+    list.PopFront();
+    throw std::runtime_error("pop from empty list should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+}
+
+template<typename Tag>
+std::vector<int> IntrusiveListIds(const IntrusiveList<Connection, Tag>& list) {
+  std::vector<int> ids;
+  for (const Connection& connection : list) {
+    ids.push_back(connection.id);
+  }
+  return ids;
+}
+
+void TestIntrusiveList() {
+  const std::string fault_toast = "IntrusiveList works wrong";
+  RandomIntGenerator generator(0, 299);
+
+  std::deque<Connection> connections;
+  for (int i = 0; i < 300; ++i) {
+    connections.emplace_back(i);
+  }
+
+  IntrusiveList<Connection> list;
+  IntrusiveList<Connection, ActiveConnectionsTag> active;
+  std::vector<int> ids;
+  std::vector<int> active_ids;
+
+  for (int i = 0; i < 3'000; ++i) {
+    Connection& connection = connections[generator.NextInt()];
+    if (!list.Contains(connection)) {
+      if (ids.empty() || generator.NextInt() % 2 == 0) {
+        list.PushBack(connection);
+        ids.push_back(connection.id);
+      } else {
+        int index = generator.NextInt() % ids.size();
+        auto position = list.IteratorTo(connections[ids[index]]);
+        if (generator.NextInt() % 2 == 0) {
+          list.InsertBefore(position, connection);
+          ids.insert(ids.begin() + index, connection.id);
+        } else {
+          list.InsertAfter(position, connection);
+          ids.insert(ids.begin() + index + 1, connection.id);
+        }
+      }
+    } else {
+      list.Erase(connection);
+      ids.erase(std::find(ids.begin(), ids.end(), connection.id));
+    }
+
+    if (connection.id % 3 == 0) {
+      if (active.Contains(connection)) {
+        active.Erase(active.IteratorTo(connection));
+        active_ids.erase(std::find(active_ids.begin(), active_ids.end(), connection.id));
+      } else {
+        active.PushFront(connection);
+        active_ids.insert(active_ids.begin(), connection.id);
+      }
+    }
+
+    AssertEqual(IntrusiveListIds(list), ids, fault_toast);
+    AssertEqual(IntrusiveListIds(active), active_ids, fault_toast);
+    AssertEqual(list.Size(), ids.size(), fault_toast);
+  }
+
+  Connection unlinked(-1);
+  try {
+    list.Erase(unlinked);
+    throw std::runtime_error("erasing an object which is not in the list should throw an exception");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+  if (!list.IsEmpty()) {
+    Connection& front = list.Front();
+    try {
+      list.PushBack(front);
+      throw std::runtime_error("linking an object twice should throw an exception");
+    } catch (const std::invalid_argument& ex) {
+      // everything is correct
+    }
+    IntrusiveList<Connection> other;
+    try {
+      other.Erase(list.begin());
+      throw std::runtime_error("erasing by an iterator of another list should throw an exception");
+    } catch (const std::invalid_argument& ex) {
+      // everything is correct
+    }
+    try {
+      other.InsertAfter(list.begin(), unlinked);
+      throw std::runtime_error("inserting at an iterator of another list should throw an exception");
+    } catch (const std::invalid_argument& ex) {
+      // everything is correct
+    }
+    Assert(list.Contains(front) && !static_cast<IntrusiveListHook<>&>(unlinked).IsLinked() && other.IsEmpty(), fault_toast);
+    list.PopFront();
+    Assert(!list.Contains(front), "PopFront should unlink the object");
+  }
+
+  list.Clear();
+  active.Clear();
+  Assert(list.IsEmpty() && list.begin() == list.end(), "Clear should empty the list");
+  for (const Connection& connection : connections) {
+    Assert(!list.Contains(connection) && !active.Contains(connection), "Clear should unlink the objects");
+  }
+  try {
+    list.PopBack();
+    throw std::runtime_error("pop from empty list should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+}
+
+void TestConcurrentList() {
+  const int kThreadsCount = 4;
+  const int kValuesPerThread = 1'000'000;
+  ConcurrentList<int> list;
+
+  // Every worker inserts and erases only around its own elements, so its
+  // iterators stay valid and the relative order of its elements is known
+  std::vector<std::vector<int>> expected(kThreadsCount);
+  std::vector<std::thread> workers;
+  for (int thread_index = 0; thread_index < kThreadsCount; ++thread_index) {
+    workers.emplace_back([&list, &expected, thread_index, kValuesPerThread] {
+      RandomIntGenerator generator(0, 1'000'000, thread_index);
+      std::vector<int>& values = expected[thread_index];
+      std::vector<ConcurrentList<int>::Iterator> iterators;
+      int next_value = thread_index * kValuesPerThread;
+
+      {
+        ConcurrentList<int>::Guard guard;
+        for (int i = 0; i < 50; ++i) {
+          iterators.push_back(list.PushBack(guard, next_value));
+          values.push_back(next_value++);
+        }
+      }
+      for (int i = 0; i < 5'000; ++i) {
+        ConcurrentList<int>::Guard guard;
+        size_t index = generator.NextInt() % values.size();
+        switch (generator.NextInt() % 3) {
+          case 0: {
+            iterators.insert(iterators.begin() + index + 1, list.InsertAfter(guard, iterators[index], next_value));
+            values.insert(values.begin() + index + 1, next_value++);
+            break;
+          }
+          case 1: {
+            iterators.insert(iterators.begin() + index, list.InsertBefore(guard, iterators[index], next_value));
+            values.insert(values.begin() + index, next_value++);
+            break;
+          }
+          default: {
+            if (values.size() > 1) {
+              if (!list.Erase(guard, iterators[index])) {
+                throw std::runtime_error("ConcurrentList lost an element");
+              }
+              iterators.erase(iterators.begin() + index);
+              values.erase(values.begin() + index);
+            }
+            break;
+          }
+        }
+      }
+    });
+  }
+
+  std::atomic<bool> finished(false);
+  std::thread reader([&list, &finished] {
+    while (!finished) {
+      std::vector<int> snapshot = list.AsArray();
+      ConcurrentList<int>::Guard guard;
+      auto position = list.FindIf(guard, [](int x) { return x % 7 == 3; });
+      if (position != list.end() && *position % 7 != 3) {
+        throw std::runtime_error("FindIf returned wrong element");
+      }
+    }
+  });
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  finished = true;
+  reader.join();
+
+  std::vector<int> result = list.AsArray();
+  size_t expected_size = 0;
+  for (int thread_index = 0; thread_index < kThreadsCount; ++thread_index) {
+    std::vector<int> thread_values;
+    for (int value : result) {
+      if (value / kValuesPerThread == thread_index) {
+        thread_values.push_back(value);
+      }
+    }
+    AssertEqual(thread_values, expected[thread_index], "ConcurrentList broke order of elements");
+    expected_size += expected[thread_index].size();
+  }
+  AssertEqual(list.Size(), expected_size, "ConcurrentList size is wrong");
+  AssertEqual(result.size(), expected_size, "ConcurrentList size is wrong");
+
+  int front = -1;
+  int back = -1;
+  Assert(list.TryPopFront(&front) && front == result.front(), "TryPopFront works wrong");
+  Assert(list.TryPopBack(&back) && back == result.back(), "TryPopBack works wrong");
+  while (list.TryPopFront(&front)) {
+  }
+  Assert(list.IsEmpty() && list.AsArray().empty(), "ConcurrentList should be empty");
+  try {
+    ConcurrentList<int>::Guard guard;
+    list.Erase(guard, list.end());
+    throw std::runtime_error("erase should throw an exception after invocation from end()");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+
+  // Hundreds of threads are pinned at the same time
+  const int kPinnedThreadsCount = 300;
+  std::atomic<int> pinned_count(0);
+  std::vector<std::thread> pinned_threads;
+  for (int thread_index = 0; thread_index < kPinnedThreadsCount; ++thread_index) {
+    pinned_threads.emplace_back([&list, &pinned_count, thread_index, kPinnedThreadsCount] {
+      ConcurrentList<int>::Guard guard;
+      ++pinned_count;
+      while (pinned_count < kPinnedThreadsCount) {
+        std::this_thread::yield();
+      }
+      ConcurrentList<int>::Iterator position = list.PushBack(guard, thread_index);
+      if (!list.Erase(guard, position)) {
+        throw std::runtime_error("ConcurrentList lost an element");
+      }
+    });
+  }
+  for (std::thread& thread : pinned_threads) {
+    thread.join();
+  }
+  Assert(list.IsEmpty(), "ConcurrentList should be empty");
+
+  // With no pinned threads, two epoch advances free everything retired
+  for (int i = 0; i < 3; ++i) {
+    EpochDomain::Instance().PendingCount();
+  }
+  AssertEqual(EpochDomain::Instance().PendingCount(), 0u, "erased nodes were not reclaimed");
+}
+
+void TestCompactList() {
+  const std::string fault_toast = "CompactList works wrong";
+  RandomIntGenerator value_generator(-1'000'000'000, 1'000'000'000);
+  RandomIntGenerator action_generator(0, 5);
+
+  CompactList<int> list(std::vector<int>{1, 2, 3});
+  std::vector<int> vec{1, 2, 3};
+
+  for (int i = 0; i < 3'000; ++i) {
+    int value = value_generator.NextInt();
+    int iterator_index = vec.empty() ? 0 : abs(value_generator.NextInt()) % vec.size();
+    auto iterator = list.begin();
+    for (int j = 0; j < iterator_index; ++j) {
+      ++iterator;
+    }
+
+    switch (action_generator.NextInt()) {
+      case 0: {
+        list.InsertAfter(iterator, value);
+        vec.insert(vec.empty() ? vec.end() : vec.begin() + iterator_index + 1, value);
+        break;
+      }
+      case 1: {
+        list.InsertBefore(iterator, value);
+        vec.insert(vec.begin() + iterator_index, value);
+        break;
+      }
+      case 2: {
+        list.PushFront(value);
+        vec.insert(vec.begin(), value);
+        break;
+      }
+      default: {
+        if (!vec.empty()) {
+          list.Erase(iterator);
+          vec.erase(vec.begin() + iterator_index);
+        }
+        break;
+      }
+    }
+    AssertEqual(list.AsArray(), vec, fault_toast);
+    AssertEqual(list.Size(), vec.size(), fault_toast);
+  }
+
+  // Iterators keep indices, so they survive the growth of the node array
+  CompactList<std::string> strings;
+  strings.PushBack("first");
+  auto first = strings.begin();
+  for (int i = 0; i < 1'000; ++i) {
+    strings.PushBack(std::to_string(i));
+  }
+  AssertEqual(*first, std::string("first"), "iterator was invalidated by growth");
+  strings.Erase(first);
+  size_t memory_usage = strings.MemoryUsage();
+  strings.PushFront("reused");
+  AssertEqual(strings.MemoryUsage(), memory_usage, "erased slot was not reused");
+  AssertEqual(strings.Front(), std::string("reused"), fault_toast);
+  AssertEqual(*(--strings.end()), std::string("999"), fault_toast);
+  AssertEqual(*strings.Find("500"), std::string("500"), fault_toast);
+  Assert(strings.Find([](const std::string& s) { return s.empty(); }) == strings.end(), fault_toast);
+
+  // A copy-only type without default constructor and assignment; erased
+  // values are destroyed at once, live ones survive the array growth
+  struct Resource {
+    explicit Resource(const std::shared_ptr<int>& owner) : owner(owner) {}
+    Resource(const Resource& other) = default;
+    const std::shared_ptr<int> owner;
+  };
+  auto owner = std::make_shared<int>(0);
+  {
+    CompactList<Resource> resources;
+    for (int i = 0; i < 100; ++i) {
+      resources.PushBack(Resource(owner));
+    }
+    resources.PopFront();
+    resources.Erase(resources.begin());
+    AssertEqual(owner.use_count(), 99l, "erased values should be destroyed");
+    resources.PushBack(Resource(owner));
+    for (int i = 0; i < 1'000; ++i) {
+      resources.PushFront(Resource(owner));
+    }
+    AssertEqual(owner.use_count(), 1'100l, "values were lost in the array growth");
+  }
+  AssertEqual(owner.use_count(), 1l, "values should be destroyed with the list");
+
+  strings.Clear();
+  Assert(strings.IsEmpty() && strings.begin() == strings.end(), "Clear should empty the list");
+  try {
+    strings.PopBack();
+    throw std::runtime_error("pop from empty list should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+  try {
+    *strings.end();
+    throw std::runtime_error("operator* from end() should throw an exception");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+}
+
+void TestOrderStatisticsList() {
+  const std::string fault_toast = "OrderStatisticsList works wrong";
+  RandomIntGenerator value_generator(-1'000'000'000, 1'000'000'000);
+  RandomIntGenerator action_generator(0, 6);
+
+  OrderStatisticsList<int> list(std::vector<int>{1, 2, 3});
+  std::vector<int> vec{1, 2, 3};
+
+  for (int i = 0; i < 5'000; ++i) {
+    int value = value_generator.NextInt();
+    size_t index = vec.empty() ? 0 : abs(value_generator.NextInt()) % vec.size();
+    auto iterator = list.IteratorAt(index);
+    AssertEqual(list.IndexOf(iterator), index, "IndexOf works wrong");
+
+    switch (action_generator.NextInt()) {
+      case 0: {
+        list.InsertAfter(iterator, value);
+        vec.insert(vec.empty() ? vec.end() : vec.begin() + index + 1, value);
+        break;
+      }
+      case 1: {
+        list.InsertBefore(iterator, value);
+        vec.insert(vec.begin() + index, value);
+        break;
+      }
+      case 2: {
+        size_t position = abs(value) % (vec.size() + 1);
+        list.InsertAt(position, value);
+        vec.insert(vec.begin() + position, value);
+        break;
+      }
+      case 3: {
+        list.PushFront(value);
+        vec.insert(vec.begin(), value);
+        break;
+      }
+      default: {
+        if (!vec.empty()) {
+          list.Erase(iterator);
+          vec.erase(vec.begin() + index);
+        }
+        break;
+      }
+    }
+    AssertEqual(list.Size(), vec.size(), fault_toast);
+    if (!vec.empty()) {
+      size_t checked_index = abs(value) % vec.size();
+      AssertEqual(list.At(checked_index), vec[checked_index], "At works wrong");
+    }
+    if (i % 100 == 0) {
+      AssertEqual(list.AsArray(), vec, fault_toast);
+      for (size_t j = 0; j < vec.size(); ++j) {
+        AssertEqual(list.IndexOf(list.IteratorAt(j)), j, "IndexOf works wrong");
+      }
+    }
+  }
+  AssertEqual(list.AsArray(), vec, fault_toast);
+  AssertEqual(list.IndexOf(list.end()), list.Size(), "IndexOf(end()) should be Size()");
+  Assert(list.IteratorAt(list.Size()) == list.end(), "IteratorAt(Size()) should be end()");
+
+  while (!list.IsEmpty()) {
+    list.PopBack();
+  }
+  list.PushBack(42);
+  AssertEqual(list.At(0), 42, fault_toast);
+  AssertEqual(list.Front(), list.Back(), fault_toast);
+
+  try {
+    list.At(1);
+    throw std::runtime_error("At out of bounds should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+  try {
+    list.InsertAt(2, 0);
+    throw std::runtime_error("InsertAt out of bounds should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+  OrderStatisticsList<int> other_list;
+  try {
+    list.IndexOf(other_list.end());
+    throw std::runtime_error("IndexOf should throw an exception for a foreign iterator");
+  } catch (const std::invalid_argument& ex) {
+    // everything is correct
+  }
+  list.Clear();
+  try {
+    list.PopFront();
+    throw std::runtime_error("pop from empty list should throw an exception");
+  } catch (const std::out_of_range& ex) {
+    // everything is correct
+  }
+}
+
+void TestLruCache() {
+  const std::string fault_toast = "LruCache works wrong";
+
+  std::vector<int> evicted_keys;
+  LruCache<int, std::string> cache(3);
+  cache.SetEvictionCallback([&evicted_keys](const int& key, const std::string&) {
+    evicted_keys.push_back(key);
+  });
+  cache.Put(1, "one");
+  cache.Put(2, "two");
+  cache.Put(3, "three");
+  AssertEqual(*cache.Get(1), std::string("one"), fault_toast);
+  cache.Put(4, "four");
+  AssertEqual(evicted_keys, std::vector<int>{2}, "the least recently used entry should be evicted");
+  Assert(cache.Get(2) == nullptr, fault_toast);
+  cache.Put(3, "THREE");
+  cache.Put(5, "five");
+  AssertEqual(evicted_keys, std::vector<int>({2, 1}), fault_toast);
+  AssertEqual(*cache.Get(3), std::string("THREE"), fault_toast);
+  Assert(cache.Erase(4) && !cache.Erase(4) && !cache.Contains(4), fault_toast);
+  AssertEqual(cache.Size(), 2u, fault_toast);
+  AssertEqual(evicted_keys.size(), 2u, "explicit Erase should not call the eviction callback");
+
+  LruCacheStats stats = cache.Stats();
+  AssertEqual(stats.hits_count, 2u, "wrong hits count");
+  AssertEqual(stats.misses_count, 1u, "wrong misses count");
+  AssertEqual(stats.evictions_count, 2u, "wrong evictions count");
+  cache.ResetStats();
+  AssertEqual(cache.Stats().hits_count, 0u, fault_toast);
+
+  // Capacity in bytes
+  LruCache<std::string, std::string> bytes_cache(10, [](const std::string& key, const std::string& value) {
+    return key.size() + value.size();
+  });
+  bytes_cache.Put("a", "1234");
+  bytes_cache.Put("b", "1234");
+  AssertEqual(bytes_cache.Weight(), 10u, fault_toast);
+  bytes_cache.Put("c", "1");
+  Assert(!bytes_cache.Contains("a") && bytes_cache.Contains("b"), fault_toast);
+  bytes_cache.Put("d", std::string(20, 'x'));
+  Assert(bytes_cache.IsEmpty() && bytes_cache.Weight() == 0, "an entry heavier than capacity should be evicted");
+
+  // Values without a default constructor
+  struct Version {
+    explicit Version(int number) : number(number) {}
+    int number;
+  };
+  LruCache<int, Version> versions(2);
+  versions.Put(1, Version(1));
+  const Version second(2);
+  versions.Put(2, second);
+  versions.Put(1, Version(3));
+  versions.Put(3, Version(4));
+  Assert(!versions.Contains(2), fault_toast);
+  AssertEqual(versions.Get(1)->number, 3, fault_toast);
+
+  // Random operations against a recency ordered vector
+  RandomIntGenerator generator(0, 30);
+  const size_t capacity = 8;
+  LruCache<int, int> random_cache(capacity);
+  std::vector<std::pair<int, int>> recency;
+  auto find_key = [&recency](int key) {
+    return std::find_if(recency.begin(), recency.end(),
+                        [key](const std::pair<int, int>& entry) { return entry.first == key; });
+  };
+  for (int i = 0; i < 5'000; ++i) {
+    int key = generator.NextInt();
+    auto found = find_key(key);
+    switch (i % 3) {
+      case 0: {
+        int* value = random_cache.Get(key);
+        Assert((value == nullptr) == (found == recency.end()), fault_toast);
+        if (value != nullptr) {
+          AssertEqual(*value, found->second, fault_toast);
+          std::rotate(recency.begin(), found, found + 1);
+        }
+        break;
+      }
+      case 1: {
+        random_cache.Put(key, i);
+        if (found != recency.end()) {
+          recency.erase(found);
+        }
+        recency.insert(recency.begin(), {key, i});
+        if (recency.size() > capacity) {
+          recency.pop_back();
+        }
+        break;
+      }
+      default: {
+        AssertEqual(random_cache.Erase(key), found != recency.end(), fault_toast);
+        if (found != recency.end()) {
+          recency.erase(found);
+        }
+        break;
+      }
+    }
+    AssertEqual(random_cache.Size(), recency.size(), fault_toast);
+  }
+}
@@ -7,11 +7,14 @@
 
 void TestEmpty();
 void TestAsArrayAndContainerConstructor();
+void TestRangeConstructorAndDrain();
+void TestCopyAndMove();
 
 void TestIterator();
 void TestIteratorExceptions();
 void TestConstIterator();
 void TestConstIteratorExceptions();
+void TestUncheckedIterator();
 void TestForEachCycle();
 
 void TestPushPopRandomly();
@@ -19,8 +22,22 @@ void TestPushPopExceptions();
 
 void TestFindValue();
 void TestFindPredicate();
+void TestPredicateAlgorithms();
+void TestParallelAlgorithms();
 void TestErase();
+void TestEraseRange();
 void TestInsertEraseRandomly();
+void TestCompact();
+
+void TestUnrolledList();
+void TestUnrolledListInsertEraseRandomly();
+
+void TestIndexedList();
+void TestIntrusiveList();
+void TestConcurrentList();
+void TestCompactList();
+void TestOrderStatisticsList();
+void TestLruCache();
 
 
 #endif //BIDIRECTIONALLIST_TESTS_H
@@ -0,0 +1,212 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmarking_framework.h"
+#include "list.h"
+#include "throughput_benchmarks.h"
+
+namespace {
+
+struct Point {
+  int x;
+  int y;
+};
+
+const unsigned kSeed = 2018;
+const size_t kLargeValueSize = 16;
+
+template<typename T>
+T MakeValue(int seed);
+
+template<>
+int MakeValue<int>(int seed) {
+  return seed;
+}
+
+template<>
+Point MakeValue<Point>(int seed) {
+  return {seed, -seed};
+}
+
+template<>
+std::vector<int> MakeValue<std::vector<int>>(int seed) {
+  return std::vector<int>(kLargeValueSize, seed);
+}
+
+// One interface over BiDirectionalList and the standard containers
+template<typename T>
+class BiDirectionalListAdapter {
+ public:
+  using ValueType = T;
+  using Iterator = typename BiDirectionalList<T>::Iterator;
+
+  size_t Size() const { return list_.Size(); }
+  Iterator Begin() { return list_.begin(); }
+
+  void PushFront(T&& value) { list_.PushFront(std::move(value)); }
+  void PushBack(T&& value) { list_.PushBack(std::move(value)); }
+  void PopFront() { list_.PopFront(); }
+  void PopBack() { list_.PopBack(); }
+
+  void InsertBefore(Iterator position, T&& value) { list_.InsertBefore(position, std::move(value)); }
+  void InsertAfter(Iterator position, T&& value) { list_.InsertAfter(position, std::move(value)); }
+  void Erase(Iterator position) { list_.Erase(position); }
+
+ private:
+  BiDirectionalList<T> list_;
+};
+
+template<typename Container>
+class StdContainerAdapter {
+ public:
+  using ValueType = typename Container::value_type;
+  using Iterator = typename Container::iterator;
+
+  size_t Size() const { return container_.size(); }
+  Iterator Begin() { return container_.begin(); }
+
+  void PushFront(ValueType&& value) { container_.push_front(std::move(value)); }
+  void PushBack(ValueType&& value) { container_.push_back(std::move(value)); }
+  void PopFront() { container_.pop_front(); }
+  void PopBack() { container_.pop_back(); }
+
+  void InsertBefore(Iterator position, ValueType&& value) { container_.insert(position, std::move(value)); }
+  void InsertAfter(Iterator position, ValueType&& value) {
+    container_.insert(std::next(position), std::move(value));
+  }
+  void Erase(Iterator position) { container_.erase(position); }
+
+ private:
+  Container container_;
+};
+
+// TestPushPopRandomly: pushes to random ends, then pushes and pops
+// at both ends with equal probabilities
+struct PushPopWorkload {
+  static const int kInitialSize = 10'000;
+  static const int kOperationsCount = 2'000'000;
+
+  template<typename Adapter>
+  static void Run(Adapter& adapter) {
+    using T = typename Adapter::ValueType;
+    std::mt19937 generator(kSeed);
+    std::uniform_int_distribution<int> action_distribution(0, 3);
+
+    for (int i = 0; i < kInitialSize; ++i) {
+      if (action_distribution(generator) % 2 == 0) {
+        adapter.PushFront(MakeValue<T>(i));
+      } else {
+        adapter.PushBack(MakeValue<T>(i));
+      }
+    }
+    for (int i = 0; i < kOperationsCount; ++i) {
+      switch (action_distribution(generator)) {
+        case 0:adapter.PushFront(MakeValue<T>(i));
+          break;
+        case 1:adapter.PushBack(MakeValue<T>(i));
+          break;
+        case 2:
+          if (adapter.Size() > 0) {
+            adapter.PopFront();
+          }
+          break;
+        default:
+          if (adapter.Size() > 0) {
+            adapter.PopBack();
+          }
+          break;
+      }
+    }
+  }
+};
+
+// TestInsertEraseRandomly: inserts before or after and erases
+// at a random position, which is reached from the front
+struct InsertEraseWorkload {
+  static const int kInitialSize = 1'000;
+  static const int kOperationsCount = 20'000;
+
+  template<typename Adapter>
+  static void Run(Adapter& adapter) {
+    using T = typename Adapter::ValueType;
+    std::mt19937 generator(kSeed);
+    std::uniform_int_distribution<int> action_distribution(0, 2);
+
+    for (int i = 0; i < kInitialSize; ++i) {
+      adapter.PushBack(MakeValue<T>(i));
+    }
+    for (int i = 0; i < kOperationsCount; ++i) {
+      if (adapter.Size() == 0) {
+        adapter.PushBack(MakeValue<T>(i));
+        continue;
+      }
+      auto position = std::next(adapter.Begin(), generator() % adapter.Size());
+      switch (action_distribution(generator)) {
+        case 0:adapter.InsertBefore(position, MakeValue<T>(i));
+          break;
+        case 1:adapter.InsertAfter(position, MakeValue<T>(i));
+          break;
+        default:adapter.Erase(position);
+          break;
+      }
+    }
+  }
+};
+
+template<typename Workload, typename Adapter>
+void MeasureThroughput(const std::string& name) {
+  const size_t operations_count = Workload::kInitialSize + Workload::kOperationsCount;
+
+  ResetPeakRss();
+  size_t rss_before = PeakRssKilobytes();
+  AllocationStats before = CurrentAllocationStats();
+  double elapsed = 0;
+  {
+    Adapter adapter;
+    auto start = std::chrono::steady_clock::now();
+    Workload::Run(adapter);
+    auto finish = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration<double, std::nano>(finish - start).count();
+    DoNotOptimize(adapter);
+  }
+  AllocationStats after = CurrentAllocationStats();
+  size_t rss_after = PeakRssKilobytes();
+
+  ReportNanosecondsPerOperation(name, elapsed, operations_count);
+  std::cout << "    " << std::fixed << std::setprecision(2) << operations_count / elapsed * 1e3 << " Mops/s, "
+            << after.allocations_count - before.allocations_count << " allocations, "
+            << (rss_after > rss_before ? rss_after - rss_before : 0) << " KiB peak RSS growth" << std::endl;
+}
+
+template<typename Workload, typename T>
+void CompareContainers(const std::string& type_name) {
+  MeasureThroughput<Workload, BiDirectionalListAdapter<T>>("BiDirectionalList<" + type_name + ">");
+  MeasureThroughput<Workload, StdContainerAdapter<std::list<T>>>("std::list<" + type_name + ">");
+  MeasureThroughput<Workload, StdContainerAdapter<std::deque<T>>>("std::deque<" + type_name + ">");
+}
+
+}  // namespace
+
+void BenchmarkPushPopThroughput() {
+  CompareContainers<PushPopWorkload, int>("int");
+  CompareContainers<PushPopWorkload, Point>("Point");
+  CompareContainers<PushPopWorkload, std::vector<int>>("vector<int>");
+}
+
+void BenchmarkInsertEraseThroughput() {
+  CompareContainers<InsertEraseWorkload, int>("int");
+  CompareContainers<InsertEraseWorkload, Point>("Point");
+  CompareContainers<InsertEraseWorkload, std::vector<int>>("vector<int>");
+}
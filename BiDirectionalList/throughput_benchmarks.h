@@ -0,0 +1,13 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_THROUGHPUT_BENCHMARKS_H
+#define BIDIRECTIONALLIST_THROUGHPUT_BENCHMARKS_H
+
+// The operation mixes of TestPushPopRandomly and TestInsertEraseRandomly
+// run on BiDirectionalList, std::list and std::deque
+void BenchmarkPushPopThroughput();
+void BenchmarkInsertEraseThroughput();
+
+#endif //BIDIRECTIONALLIST_THROUGHPUT_BENCHMARKS_H
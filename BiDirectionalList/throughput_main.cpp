@@ -0,0 +1,11 @@
+#include "throughput_benchmarks.h"
+#include "benchmarking_framework.h"
+
+int main() {
+  BenchmarkRunner runner;
+
+  runner.RunBenchmark(BenchmarkPushPopThroughput, "BenchmarkPushPopThroughput");
+  runner.RunBenchmark(BenchmarkInsertEraseThroughput, "BenchmarkInsertEraseThroughput");
+
+  return 0;
+}
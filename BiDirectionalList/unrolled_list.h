@@ -0,0 +1,723 @@
+//
+// Created by user on 18.10.2026.
+//
+
+#ifndef BIDIRECTIONALLIST_UNROLLED_LIST_H
+#define BIDIRECTIONALLIST_UNROLLED_LIST_H
+
+// Unrolled variant of BiDirectionalList: every node keeps up to kNodeCapacity
+// elements in an inline array, so a scan touches one node (and one cache miss)
+// per kNodeCapacity elements instead of one per element.
+//
+// Insertion into a full node splits it in halves, erasure merges a node that
+// became less than a quarter full with one of its neighbours. Both operations
+// move elements between nodes, so InsertBefore/InsertAfter/Erase invalidate
+// all iterators pointing into the touched node and its neighbours.
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <iterator>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename T, size_t kNodeCapacity = 16>
+class UnrolledList {
+  static_assert(kNodeCapacity >= 4, "node capacity is too small to be split and merged");
+
+ protected:
+  struct Node;
+
+ public:
+  class Iterator : public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    Iterator(const Iterator& other) = default;
+
+    T& operator*() const;
+    T* operator->() const;
+
+    Iterator& operator++();
+    const Iterator operator++(int);
+
+    Iterator& operator--();
+    const Iterator operator--(int);
+
+    Iterator& operator=(const Iterator& other);
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class UnrolledList;
+
+    const UnrolledList* const list_;
+    Node* node_;
+    size_t index_;
+
+    Iterator(const UnrolledList* const list, Node* node, size_t index)
+        : list_(list), node_(node), index_(index) {}
+  };
+
+  class ConstIterator :
+      public std::iterator<std::bidirectional_iterator_tag, T> {
+   public:
+    ConstIterator(const ConstIterator& other) = default;
+
+    const T& operator*() const;
+    const T* operator->() const;
+
+    ConstIterator& operator++();
+    const ConstIterator operator++(int);
+
+    ConstIterator& operator--();
+    const ConstIterator operator--(int);
+
+    ConstIterator& operator=(const ConstIterator& other);
+    bool operator==(const ConstIterator& other) const;
+    bool operator!=(const ConstIterator& other) const;
+
+   private:
+    friend class UnrolledList;
+
+    const UnrolledList* const list_;
+    const Node* node_;
+    size_t index_;
+
+    ConstIterator(const UnrolledList* const list, const Node* node, size_t index)
+        : list_(list), node_(node), index_(index) {}
+  };
+
+  UnrolledList() : size_(0), first_(nullptr), last_(nullptr) {}
+
+  template<typename Container>
+  explicit UnrolledList(const Container&);
+
+  UnrolledList(const UnrolledList&) = delete;
+  UnrolledList& operator=(const UnrolledList&) = delete;
+
+  ~UnrolledList() { Clear(); }
+
+  bool IsEmpty() const;
+
+  size_t Size() const;
+
+  void Clear();
+
+  Iterator begin();
+  Iterator end();
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  std::vector<T> AsArray() const;
+
+  void InsertBefore(Iterator position, const T& value);
+  void InsertBefore(Iterator position, T&& value);
+
+  void InsertAfter(Iterator position, const T& value);
+  void InsertAfter(Iterator position, T&& value);
+
+  void PushBack(const T& value);
+  void PushBack(T&& value);
+
+  void PushFront(const T& value);
+  void PushFront(T&& value);
+
+  void Erase(Iterator position);
+
+  void PopFront();
+  void PopBack();
+
+  T Front() const;
+  T Back() const;
+
+  Iterator Find(const T& value);
+  ConstIterator Find(const T& value) const;
+
+  Iterator Find(std::function<bool(const T&)> predicate);
+  ConstIterator Find(std::function<bool(const T&)> predicate) const;
+
+ protected:
+  struct Node {
+    Node();
+    ~Node();
+
+    T& At(size_t index);
+    const T& At(size_t index) const;
+
+    void Insert(size_t index, T&& value);
+    void Erase(size_t index);
+
+    // Moves elements [from, count_) to the end of 'other'
+    void MoveTail(size_t from, Node* other);
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type elements_[kNodeCapacity];
+    size_t count_;
+
+    Node* next_node_;
+    Node* previous_node_;
+  };
+
+  size_t size_;
+
+  Node* first_;
+  Node* last_;
+
+  template<typename U>
+  void InsertAt(Node* node, size_t index, U&& value);
+  void EraseAt(Node* node, size_t index);
+
+  Node* LinkNodeAfter(Node* existing_node);
+  Node* LinkNodeBefore(Node* existing_node);
+  void UnlinkNode(Node* node);
+};
+
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+template<typename T, size_t kNodeCapacity>
+T& UnrolledList<T, kNodeCapacity>::Iterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->At(index_);
+}
+
+template<typename T, size_t kNodeCapacity>
+T* UnrolledList<T, kNodeCapacity>::Iterator::operator->() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(node_->At(index_));
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator& UnrolledList<T, kNodeCapacity>::Iterator::operator++() {
+  if (node_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  if (++index_ == node_->count_) {
+    node_ = node_->next_node_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+const typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::Iterator::operator++(int) {
+  Iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator& UnrolledList<T, kNodeCapacity>::Iterator::operator--() {
+  if (node_ == list_->first_ && index_ == 0) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  if (index_ == 0) {
+    node_ = node_ ? node_->previous_node_ : list_->last_;
+    index_ = node_->count_;
+  }
+  --index_;
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+const typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::Iterator::operator--(int) {
+  Iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator& UnrolledList<T, kNodeCapacity>::Iterator::operator=(const UnrolledList::Iterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  node_ = other.node_;
+  index_ = other.index_;
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+bool UnrolledList<T, kNodeCapacity>::Iterator::operator==(const UnrolledList::Iterator& other) const {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+template<typename T, size_t kNodeCapacity>
+bool UnrolledList<T, kNodeCapacity>::Iterator::operator!=(const UnrolledList::Iterator& other) const {
+  return !(*this == other);
+}
+// |--------------------------------------------------------------------------------------|
+// |----------------------------- Iterator methods declaration ---------------------------|
+// |--------------------------------------------------------------------------------------|
+
+
+
+
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+template<typename T, size_t kNodeCapacity>
+const T& UnrolledList<T, kNodeCapacity>::ConstIterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->At(index_);
+}
+
+template<typename T, size_t kNodeCapacity>
+const T* UnrolledList<T, kNodeCapacity>::ConstIterator::operator->() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return &(node_->At(index_));
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator& UnrolledList<T, kNodeCapacity>::ConstIterator::operator++() {
+  if (node_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  if (++index_ == node_->count_) {
+    node_ = node_->next_node_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+const typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator& UnrolledList<T, kNodeCapacity>::ConstIterator::operator--() {
+  if (node_ == list_->first_ && index_ == 0) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  if (index_ == 0) {
+    node_ = node_ ? node_->previous_node_ : list_->last_;
+    index_ = node_->count_;
+  }
+  --index_;
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+const typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator& UnrolledList<T, kNodeCapacity>::ConstIterator::operator=(const UnrolledList::ConstIterator& other) {
+  if (list_ != other.list_) {
+    throw std::invalid_argument("Trying to assign iterator from another list");
+  }
+  node_ = other.node_;
+  index_ = other.index_;
+  return *this;
+}
+
+template<typename T, size_t kNodeCapacity>
+bool UnrolledList<T, kNodeCapacity>::ConstIterator::operator==(const UnrolledList::ConstIterator& other) const {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+template<typename T, size_t kNodeCapacity>
+bool UnrolledList<T, kNodeCapacity>::ConstIterator::operator!=(const UnrolledList::ConstIterator& other) const {
+  return !(*this == other);
+}
+// |------------------------------------------------------------------------------------------|
+// |---------------------------- ConstIterator methods declaration ---------------------------|
+// |------------------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+template<typename T, size_t kNodeCapacity>
+UnrolledList<T, kNodeCapacity>::Node::Node() : count_(0),
+                                               next_node_(nullptr),
+                                               previous_node_(nullptr) {}
+
+template<typename T, size_t kNodeCapacity>
+UnrolledList<T, kNodeCapacity>::Node::~Node() {
+  for (size_t i = 0; i < count_; ++i) {
+    At(i).~T();
+  }
+}
+
+template<typename T, size_t kNodeCapacity>
+T& UnrolledList<T, kNodeCapacity>::Node::At(size_t index) {
+  return *reinterpret_cast<T*>(&elements_[index]);
+}
+
+template<typename T, size_t kNodeCapacity>
+const T& UnrolledList<T, kNodeCapacity>::Node::At(size_t index) const {
+  return *reinterpret_cast<const T*>(&elements_[index]);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::Node::Insert(size_t index, T&& value) {
+  for (size_t i = count_; i > index; --i) {
+    new (&elements_[i]) T(std::move(At(i - 1)));
+    At(i - 1).~T();
+  }
+  new (&elements_[index]) T(std::move(value));
+  ++count_;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::Node::Erase(size_t index) {
+  At(index).~T();
+  for (size_t i = index + 1; i < count_; ++i) {
+    new (&elements_[i - 1]) T(std::move(At(i)));
+    At(i).~T();
+  }
+  --count_;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::Node::MoveTail(size_t from, Node* other) {
+  for (size_t i = from; i < count_; ++i) {
+    new (&other->elements_[other->count_++]) T(std::move(At(i)));
+    At(i).~T();
+  }
+  count_ = from;
+}
+// |---------------------------------------------------------------------------------|
+// |---------------------------- Node methods declaration ---------------------------|
+// |---------------------------------------------------------------------------------|
+
+
+
+
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------------- UnrolledList methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+template<typename T, size_t kNodeCapacity>
+template<typename Container>
+UnrolledList<T, kNodeCapacity>::UnrolledList(const Container& container) : size_(0), first_(nullptr), last_(nullptr) {
+  for (const T& item : container) {
+    PushBack(item);
+  }
+}
+
+template<typename T, size_t kNodeCapacity>
+bool UnrolledList<T, kNodeCapacity>::IsEmpty() const {
+  return size_ == 0;
+}
+
+template<typename T, size_t kNodeCapacity>
+size_t UnrolledList<T, kNodeCapacity>::Size() const {
+  return size_;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::Clear() {
+  Node* node = first_;
+  while (node != nullptr) {
+    Node* next_node = node->next_node_;
+    delete node;
+    node = next_node;
+  }
+  first_ = last_ = nullptr;
+  size_ = 0;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::begin() {
+  return {this, first_, 0};
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::end() {
+  return {this, nullptr, 0};
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::begin() const {
+  return {this, first_, 0};
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::end() const {
+  return {this, nullptr, 0};
+}
+
+template<typename T, size_t kNodeCapacity>
+std::vector<T> UnrolledList<T, kNodeCapacity>::AsArray() const {
+  std::vector<T> array;
+  array.reserve(size_);
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    for (size_t i = 0; i < node->count_; ++i) {
+      array.push_back(node->At(i));
+    }
+  }
+  return array;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::InsertBefore(UnrolledList::Iterator position, const T& value) {
+  InsertAt(position.node_, position.index_, value);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::InsertBefore(UnrolledList::Iterator position, T&& value) {
+  InsertAt(position.node_, position.index_, std::move(value));
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::InsertAfter(UnrolledList::Iterator position, const T& value) {
+  if (position.node_ == nullptr) {
+    InsertAt(nullptr, 0, value);
+  } else {
+    InsertAt(position.node_, position.index_ + 1, value);
+  }
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::InsertAfter(UnrolledList::Iterator position, T&& value) {
+  if (position.node_ == nullptr) {
+    InsertAt(nullptr, 0, std::move(value));
+  } else {
+    InsertAt(position.node_, position.index_ + 1, std::move(value));
+  }
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PushBack(const T& value) {
+  InsertAt(nullptr, 0, value);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PushBack(T&& value) {
+  InsertAt(nullptr, 0, std::move(value));
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PushFront(const T& value) {
+  InsertAt(first_, 0, value);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PushFront(T&& value) {
+  InsertAt(first_, 0, std::move(value));
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::Erase(UnrolledList::Iterator position) {
+  if (position.node_ == nullptr) {
+    throw std::invalid_argument("trying to erase end()");
+  }
+  EraseAt(position.node_, position.index_);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PopFront() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop front element from empty list");
+  }
+  EraseAt(first_, 0);
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::PopBack() {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to pop back element from empty list");
+  }
+  EraseAt(last_, last_->count_ - 1);
+}
+
+template<typename T, size_t kNodeCapacity>
+T UnrolledList<T, kNodeCapacity>::Front() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access front element in empty list");
+  }
+  return first_->At(0);
+}
+
+template<typename T, size_t kNodeCapacity>
+T UnrolledList<T, kNodeCapacity>::Back() const {
+  if (IsEmpty()) {
+    throw std::out_of_range("Trying to access back element in empty list");
+  }
+  return last_->At(last_->count_ - 1);
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::Find(const T& value) {
+  for (Node* node = first_; node != nullptr; node = node->next_node_) {
+    for (size_t i = 0; i < node->count_; ++i) {
+      if (node->At(i) == value) {
+        return {this, node, i};
+      }
+    }
+  }
+  return end();
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::Find(const T& value) const {
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    for (size_t i = 0; i < node->count_; ++i) {
+      if (node->At(i) == value) {
+        return {this, node, i};
+      }
+    }
+  }
+  return end();
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Iterator UnrolledList<T, kNodeCapacity>::Find(std::function<bool(const T&)> predicate) {
+  for (Node* node = first_; node != nullptr; node = node->next_node_) {
+    for (size_t i = 0; i < node->count_; ++i) {
+      if (predicate(node->At(i))) {
+        return {this, node, i};
+      }
+    }
+  }
+  return end();
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::ConstIterator UnrolledList<T, kNodeCapacity>::Find(std::function<bool(const T&)> predicate) const {
+  for (const Node* node = first_; node != nullptr; node = node->next_node_) {
+    for (size_t i = 0; i < node->count_; ++i) {
+      if (predicate(node->At(i))) {
+        return {this, node, i};
+      }
+    }
+  }
+  return end();
+}
+
+template<typename T, size_t kNodeCapacity>
+template<typename U>
+void UnrolledList<T, kNodeCapacity>::InsertAt(UnrolledList::Node* node, size_t index, U&& value) {
+  // The value may refer to an element of this list, which the shifts below
+  // would overwrite, and its copy may throw, so it is made before any
+  // element or node is touched
+  T element(std::forward<U>(value));
+
+  if (node == nullptr) {
+    if (last_ == nullptr) {
+      LinkNodeAfter(nullptr);
+    }
+    node = last_;
+    index = last_->count_;
+  }
+
+  if (node->count_ == kNodeCapacity) {
+    // Inserting at the edge of a full node goes to the neighbouring node if
+    // it has room, or starts a new node instead of splitting, so that
+    // PushBack/PushFront and repeated inserts keep the nodes densely filled.
+    if (index == kNodeCapacity) {
+      Node* next = node->next_node_;
+      node = (next != nullptr && next->count_ < kNodeCapacity) ? next : LinkNodeAfter(node);
+      index = 0;
+    } else if (index == 0) {
+      Node* previous = node->previous_node_;
+      if (previous != nullptr && previous->count_ < kNodeCapacity) {
+        node = previous;
+        index = previous->count_;
+      } else {
+        node = LinkNodeBefore(node);
+      }
+    } else {
+      Node* new_node = LinkNodeAfter(node);
+      node->MoveTail(kNodeCapacity / 2, new_node);
+      if (index > node->count_) {
+        index -= node->count_;
+        node = new_node;
+      }
+    }
+  }
+
+  node->Insert(index, std::move(element));
+  ++size_;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::EraseAt(UnrolledList::Node* node, size_t index) {
+  node->Erase(index);
+  --size_;
+
+  if (node->count_ == 0) {
+    UnlinkNode(node);
+    return;
+  }
+  if (node->count_ >= kNodeCapacity / 4) {
+    return;
+  }
+
+  Node* next = node->next_node_;
+  Node* previous = node->previous_node_;
+  if (next != nullptr && node->count_ + next->count_ <= kNodeCapacity) {
+    next->MoveTail(0, node);
+    UnlinkNode(next);
+  } else if (previous != nullptr && previous->count_ + node->count_ <= kNodeCapacity) {
+    node->MoveTail(0, previous);
+    UnlinkNode(node);
+  }
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Node* UnrolledList<T, kNodeCapacity>::LinkNodeAfter(UnrolledList::Node* existing_node) {
+  Node* new_node = new Node();
+  if (existing_node == nullptr) {
+    first_ = last_ = new_node;
+    return new_node;
+  }
+  new_node->previous_node_ = existing_node;
+  new_node->next_node_ = existing_node->next_node_;
+  if (existing_node->next_node_ != nullptr) {
+    existing_node->next_node_->previous_node_ = new_node;
+  } else {
+    last_ = new_node;
+  }
+  existing_node->next_node_ = new_node;
+  return new_node;
+}
+
+template<typename T, size_t kNodeCapacity>
+typename UnrolledList<T, kNodeCapacity>::Node* UnrolledList<T, kNodeCapacity>::LinkNodeBefore(UnrolledList::Node* existing_node) {
+  if (existing_node->previous_node_ != nullptr) {
+    return LinkNodeAfter(existing_node->previous_node_);
+  }
+  Node* new_node = new Node();
+  new_node->next_node_ = existing_node;
+  existing_node->previous_node_ = new_node;
+  first_ = new_node;
+  return new_node;
+}
+
+template<typename T, size_t kNodeCapacity>
+void UnrolledList<T, kNodeCapacity>::UnlinkNode(UnrolledList::Node* node) {
+  if (node->previous_node_ != nullptr) {
+    node->previous_node_->next_node_ = node->next_node_;
+  } else {
+    first_ = node->next_node_;
+  }
+  if (node->next_node_ != nullptr) {
+    node->next_node_->previous_node_ = node->previous_node_;
+  } else {
+    last_ = node->previous_node_;
+  }
+  delete node;
+}
+// |---------------------------------------------------------------------------------------------------|
+// |--------------------------------- UnrolledList methods declaration --------------------------------|
+// |---------------------------------------------------------------------------------------------------|
+
+#endif //BIDIRECTIONALLIST_UNROLLED_LIST_H
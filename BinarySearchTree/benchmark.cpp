@@ -0,0 +1,471 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "binary_search_tree.h"
+
+namespace {
+
+// Не даёт компилятору выбросить вычисление, результат которого не используется
+template<class T>
+void DoNotOptimize(const T &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+template<class Func>
+double MeasureNanoseconds(Func func) {
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(finish - start).count();
+}
+
+void Report(const std::string &name, double nanoseconds, size_t operations_count) {
+  std::cout << "  " << std::left << std::setw(48) << name
+            << std::right << std::fixed << std::setprecision(3) << std::setw(12)
+            << nanoseconds / operations_count << " ns/op" << std::endl;
+}
+
+std::vector<int> MakeValues(const std::string &order, int count) {
+  std::vector<int> values(count);
+  std::iota(values.begin(), values.end(), 0);
+  if (order == "reverse") {
+    std::reverse(values.begin(), values.end());
+  } else if (order == "random") {
+    std::shuffle(values.begin(), values.end(), std::mt19937(2018));
+  }
+  return values;
+}
+
+void MeasureTree(Balancing balancing, const std::string &balancing_name,
+                 const std::string &order, int count) {
+  const std::vector<int> values = MakeValues(order, count);
+  const std::string name = balancing_name + ", " + order + ", n = " + std::to_string(count);
+
+  BinarySearchTree<int> tree(balancing);
+  double added = MeasureNanoseconds([&tree, &values] {
+    for (int value : values) {
+      tree.Add(value);
+    }
+  });
+  Report(name + ": Add", added, values.size());
+
+  double found = MeasureNanoseconds([&tree, &values] {
+    int found_count = 0;
+    for (int value : values) {
+      found_count += tree.Contains(value);
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ": Contains", found, values.size());
+
+  double erased = MeasureNanoseconds([&tree, &values] {
+    for (int value : values) {
+      tree.Erase(value);
+    }
+  });
+  Report(name + ": Erase", erased, values.size());
+}
+
+void MeasureTeardown(NodeAllocation allocation, const std::string &allocation_name,
+                     int count) {
+  const std::vector<int> values = MakeValues("random", count);
+  const std::string name = "AVL, " + allocation_name + ", random, n = " + std::to_string(count);
+
+  BinarySearchTree<int> tree(Balancing::kAvl, allocation);
+  double added = MeasureNanoseconds([&tree, &values] {
+    for (int value : values) {
+      tree.Add(value);
+    }
+  });
+  Report(name + ": Add", added, values.size());
+
+  double cleared = MeasureNanoseconds([&tree] {
+    tree.Clear();
+  });
+  Report(name + ": Clear", cleared, values.size());
+}
+
+struct Query {
+  int type;
+  int value;
+};
+
+// Последовательность запросов с тем же распределением, что и в
+// TestRandomQueries: добавление, поиск и удаление равновероятны, часть
+// значений берётся из уже добавленных. Значения, удалённые запросом со
+// случайным значением, могут остаться в 'elements', что на смесь почти
+// не влияет.
+std::vector<Query> MakeQueries(int queries_count, int max_element_value) {
+  std::mt19937_64 random_generator(2018);
+  std::vector<Query> queries;
+  queries.reserve(queries_count);
+  std::vector<int> elements;
+
+  const unsigned kRandomValuePercents[] = {75, 40, 25};
+  for (int i = 0; i < queries_count; ++i) {
+    int type = random_generator() % 3;
+    int value;
+    size_t element_index = 0;
+    if (elements.empty() || random_generator() % 100 < kRandomValuePercents[type]) {
+      value = random_generator() % max_element_value;
+      value -= max_element_value / 2;
+      element_index = elements.size();
+    } else {
+      element_index = random_generator() % elements.size();
+      value = elements[element_index];
+    }
+
+    if (type == 0) {
+      elements.push_back(value);
+    } else if (type == 2 && element_index < elements.size()) {
+      elements[element_index] = elements.back();
+      elements.pop_back();
+    }
+    queries.push_back({type, value});
+  }
+  return queries;
+}
+
+double RunQueries(NodeAllocation allocation, Duplicates duplicates,
+                  const std::vector<Query> &queries) {
+  BinarySearchTree<int> tree(Balancing::kAvl, allocation, duplicates);
+  int found_count = 0;
+  double elapsed = MeasureNanoseconds([&tree, &queries, &found_count] {
+    for (const Query &query : queries) {
+      switch (query.type) {
+        case 0:tree.Add(query.value);
+          break;
+        case 1:found_count += tree.Contains(query.value);
+          break;
+        default:tree.Erase(query.value);
+          break;
+      }
+    }
+  });
+  DoNotOptimize(found_count);
+  return elapsed;
+}
+
+void MeasureQueriesMix(int queries_count) {
+  const std::vector<int>
+      kElementsMaxValues({1, 2, 5, 13, 42, 1024, 1'000'000'000});
+
+  for (const int max_element_value : kElementsMaxValues) {
+    const std::vector<Query> queries = MakeQueries(queries_count, max_element_value);
+    const std::string name = "AVL, max_element_value = " + std::to_string(max_element_value);
+    Report(name + ", heap",
+           RunQueries(NodeAllocation::kHeap, Duplicates::kSeparateNodes, queries),
+           queries.size());
+    Report(name + ", pool",
+           RunQueries(NodeAllocation::kPool, Duplicates::kSeparateNodes, queries),
+           queries.size());
+    Report(name + ", pool, counted",
+           RunQueries(NodeAllocation::kPool, Duplicates::kCounted, queries),
+           queries.size());
+  }
+}
+
+// Поиск по std::string_view: с прозрачным компаратором ключ сравнивается
+// напрямую, иначе на каждый запрос строится временная std::string
+template<typename Compare>
+void MeasureStringLookup(const std::string &name, int count) {
+  std::vector<std::string> keys;
+  keys.reserve(count);
+  for (int value : MakeValues("random", count)) {
+    // Длинные ключи не помещаются в буфер малой строки
+    keys.push_back("key-with-a-long-common-prefix-" + std::to_string(value));
+  }
+  std::vector<std::string_view> queries(keys.begin(), keys.end());
+
+  BinarySearchTree<std::string, Compare> tree(Balancing::kAvl);
+  for (const std::string &key : keys) {
+    tree.Add(key);
+  }
+
+  double found = MeasureNanoseconds([&tree, &queries] {
+    int found_count = 0;
+    for (std::string_view query : queries) {
+      if constexpr (std::is_same<Compare, std::less<>>::value) {
+        found_count += tree.Contains(query);
+      } else {
+        found_count += tree.Contains(std::string(query));
+      }
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ", n = " + std::to_string(count) + ": Contains", found, queries.size());
+}
+
+// Порядковые статистики по дереву сравниваются с прежним способом: построить
+// ToSortedArray() и искать в нём бинарным поиском
+void MeasureOrderStatistics(int count) {
+  const std::vector<int> values = MakeValues("random", count);
+  const std::string name = "AVL, n = " + std::to_string(count);
+  const int kQueriesCount = 1'000'000;
+  const int kSortedArrayQueriesCount = 100;
+
+  BinarySearchTree<int> tree(Balancing::kAvl);
+  for (int value : values) {
+    tree.Add(value);
+  }
+
+  double ranked = MeasureNanoseconds([&tree, &values] {
+    long long rank_sum = 0;
+    for (int i = 0; i < kQueriesCount; ++i) {
+      rank_sum += tree.Rank(values[i % values.size()]);
+    }
+    DoNotOptimize(rank_sum);
+  });
+  Report(name + ": Rank", ranked, kQueriesCount);
+
+  double selected = MeasureNanoseconds([&tree, &values, count] {
+    long long value_sum = 0;
+    for (int i = 0; i < kQueriesCount; ++i) {
+      value_sum += tree.Select(values[i % values.size()] % count);
+    }
+    DoNotOptimize(value_sum);
+  });
+  Report(name + ": Select", selected, kQueriesCount);
+
+  double counted = MeasureNanoseconds([&tree, &values] {
+    long long count_sum = 0;
+    for (int i = 0; i < kQueriesCount; ++i) {
+      int lo = values[i % values.size()];
+      count_sum += tree.CountInRange(lo, lo + 1000);
+    }
+    DoNotOptimize(count_sum);
+  });
+  Report(name + ": CountInRange", counted, kQueriesCount);
+
+  double array_ranked = MeasureNanoseconds([&tree, &values] {
+    long long rank_sum = 0;
+    for (int i = 0; i < kSortedArrayQueriesCount; ++i) {
+      std::vector<int> sorted = tree.ToSortedArray();
+      rank_sum += std::lower_bound(sorted.begin(), sorted.end(), values[i])
+          - sorted.begin();
+    }
+    DoNotOptimize(rank_sum);
+  });
+  Report(name + ": ToSortedArray + lower_bound", array_ranked, kSortedArrayQueriesCount);
+}
+
+// Чтение десяти ключей, следующих за заданным: обход итератором от LowerBound
+// против копирования всего дерева через ToSortedArray()
+void MeasureRangeScan(int count) {
+  const std::vector<int> values = MakeValues("random", count);
+  const std::string name = "AVL, n = " + std::to_string(count);
+  const int kQueriesCount = 1'000'000;
+  const int kSortedArrayQueriesCount = 100;
+  const int kScanLength = 10;
+
+  BinarySearchTree<int> tree(Balancing::kAvl);
+  for (int value : values) {
+    tree.Add(value);
+  }
+
+  double scanned = MeasureNanoseconds([&tree, &values] {
+    long long value_sum = 0;
+    for (int i = 0; i < kQueriesCount; ++i) {
+      int lo = values[i % values.size()];
+      for (int value : tree.Range(lo, lo + kScanLength)) {
+        value_sum += value;
+      }
+    }
+    DoNotOptimize(value_sum);
+  });
+  Report(name + ": Range of 10", scanned, kQueriesCount);
+
+  double copied = MeasureNanoseconds([&tree, &values] {
+    long long value_sum = 0;
+    for (int i = 0; i < kSortedArrayQueriesCount; ++i) {
+      std::vector<int> sorted = tree.ToSortedArray();
+      auto first = std::lower_bound(sorted.begin(), sorted.end(), values[i]);
+      auto last = std::lower_bound(first, sorted.end(), values[i] + kScanLength);
+      value_sum += std::accumulate(first, last, 0LL);
+    }
+    DoNotOptimize(value_sum);
+  });
+  Report(name + ": ToSortedArray + 10 values", copied, kSortedArrayQueriesCount);
+}
+
+// Выгрузка всех ключей: в вектор и потоком в посетителя без вектора
+void MeasureTraversal(int count) {
+  const std::vector<int> values = MakeValues("random", count);
+  const std::string name = "AVL, n = " + std::to_string(count);
+
+  BinarySearchTree<int> tree(Balancing::kAvl);
+  for (int value : values) {
+    tree.Add(value);
+  }
+
+  double copied = MeasureNanoseconds([&tree] {
+    std::vector<int> sorted = tree.ToSortedArray();
+    DoNotOptimize(sorted);
+  });
+  Report(name + ": ToSortedArray", copied, values.size());
+
+  double visited = MeasureNanoseconds([&tree] {
+    long long value_sum = 0;
+    tree.VisitInOrder([&value_sum](int value) {
+      value_sum += value;
+    });
+    DoNotOptimize(value_sum);
+  });
+  Report(name + ": VisitInOrder", visited, values.size());
+}
+
+// Загрузка снимка: вставка по одному ключу против BuildFromSorted и
+// InsertBatch
+void MeasureBulkBuild(int count) {
+  const std::vector<int> sorted = MakeValues("sorted", count);
+  const std::vector<int> shuffled = MakeValues("random", count);
+  const std::string name = "AVL, n = " + std::to_string(count);
+
+  double added = MeasureNanoseconds([&shuffled] {
+    BinarySearchTree<int> tree(Balancing::kAvl);
+    for (int value : shuffled) {
+      tree.Add(value);
+    }
+    DoNotOptimize(tree);
+  });
+  Report(name + ": Add, random", added, count);
+
+  double built = MeasureNanoseconds([&sorted] {
+    BinarySearchTree<int> tree(Balancing::kAvl);
+    tree.BuildFromSorted(sorted.begin(), sorted.end());
+    DoNotOptimize(tree);
+  });
+  Report(name + ": BuildFromSorted", built, count);
+
+  double batched = MeasureNanoseconds([&shuffled] {
+    BinarySearchTree<int> tree(Balancing::kAvl);
+    tree.InsertBatch(shuffled.begin(), shuffled.end());
+    DoNotOptimize(tree);
+  });
+  Report(name + ": InsertBatch, random", batched, count);
+
+  // Вторая половина ключей поверх первой
+  const size_t half = shuffled.size() / 2;
+  BinarySearchTree<int> tree(Balancing::kAvl);
+  tree.InsertBatch(shuffled.begin(), shuffled.begin() + half);
+  double merged = MeasureNanoseconds([&tree, &shuffled, half] {
+    tree.InsertBatch(shuffled.begin() + half, shuffled.end());
+  });
+  Report(name + ": InsertBatch, second half", merged, shuffled.size() - half);
+
+  double contained = MeasureNanoseconds([&tree, &shuffled] {
+    int found_count = 0;
+    for (int value : shuffled) {
+      found_count += tree.Contains(value);
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ": Contains after InsertBatch", contained, count);
+}
+
+// Поиск по дереву указателей против выгруженного Freeze() индекса и
+// бинарного поиска по упорядоченному массиву; половина запросов промахивается
+void MeasureFrozenLookup(int count) {
+  const int kQueriesCount = 1'000'000;
+  std::vector<int> values = MakeValues("random", count);
+  for (int &value : values) {
+    value *= 2;
+  }
+  std::vector<int> queries(kQueriesCount);
+  std::mt19937 random_generator(2018);
+  for (int &query : queries) {
+    query = random_generator() % (2 * count);
+  }
+  const std::string name = "n = " + std::to_string(count);
+
+  BinarySearchTree<int> tree(Balancing::kAvl);
+  tree.InsertBatch(values.begin(), values.end());
+  const FrozenSearchIndex<int> index = tree.Freeze();
+  const std::vector<int> sorted = tree.ToSortedArray();
+
+  double tree_found = MeasureNanoseconds([&tree, &queries] {
+    int found_count = 0;
+    for (int query : queries) {
+      found_count += tree.Contains(query);
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ": BinarySearchTree::Contains", tree_found, queries.size());
+
+  double array_found = MeasureNanoseconds([&sorted, &queries] {
+    int found_count = 0;
+    for (int query : queries) {
+      found_count += std::binary_search(sorted.begin(), sorted.end(), query);
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ": std::binary_search", array_found, queries.size());
+
+  double index_found = MeasureNanoseconds([&index, &queries] {
+    int found_count = 0;
+    for (int query : queries) {
+      found_count += index.Contains(query);
+    }
+    DoNotOptimize(found_count);
+  });
+  Report(name + ": FrozenSearchIndex::Contains", index_found, queries.size());
+}
+
+}  // namespace
+
+int main() {
+  const std::vector<std::string> kOrders({"sorted", "reverse", "random"});
+  // Несбалансированное дерево на упорядоченном входе вырождается в список,
+  // поэтому большой размер измеряется только на случайном порядке
+  const int kSmallSize = 20'000;
+  const int kLargeSize = 1'000'000;
+
+  std::cout << "Insertion orders:" << std::endl;
+  for (const std::string &order : kOrders) {
+    MeasureTree(Balancing::kNone, "none", order, kSmallSize);
+    MeasureTree(Balancing::kAvl, "AVL", order, kSmallSize);
+  }
+  MeasureTree(Balancing::kNone, "none", "random", kLargeSize);
+  for (const std::string &order : kOrders) {
+    MeasureTree(Balancing::kAvl, "AVL", order, kLargeSize);
+  }
+
+  std::cout << "Teardown:" << std::endl;
+  MeasureTeardown(NodeAllocation::kHeap, "heap", kLargeSize);
+  MeasureTeardown(NodeAllocation::kPool, "pool", kLargeSize);
+
+  // Смесь запросов из main.cpp, увеличенная до миллиона запросов
+  const int kQueriesCount = 1'000'000;
+  std::cout << "Queries mix, n = " << kQueriesCount << ":" << std::endl;
+  MeasureQueriesMix(kQueriesCount);
+
+  std::cout << "Bulk build:" << std::endl;
+  MeasureBulkBuild(kLargeSize);
+
+  std::cout << "Order statistics:" << std::endl;
+  MeasureOrderStatistics(kLargeSize);
+
+  std::cout << "Traversal:" << std::endl;
+  MeasureTraversal(kLargeSize);
+
+  std::cout << "Range scans:" << std::endl;
+  MeasureRangeScan(kLargeSize);
+
+  std::cout << "Frozen index lookup:" << std::endl;
+  MeasureFrozenLookup(kSmallSize);
+  MeasureFrozenLookup(kLargeSize);
+
+  std::cout << "String keys, lookup by string_view:" << std::endl;
+  MeasureStringLookup<std::less<std::string>>("std::less<std::string>", kSmallSize);
+  MeasureStringLookup<std::less<>>("std::less<>", kSmallSize);
+
+  return 0;
+}
@@ -0,0 +1,1119 @@
+#ifndef BINARYSEARCHTREE_BINARY_SEARCH_TREE_H
+#define BINARYSEARCHTREE_BINARY_SEARCH_TREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "frozen_search_index.h"
+#include "node_pool.h"
+
+// Режим балансировки дерева. В режиме kAvl после каждой вставки и удаления
+// дерево перестраивается поворотами так, что высоты поддеревьев любой вершины
+// отличаются не более чем на единицу, и все операции выполняются за O(log n)
+// независимо от порядка вставки.
+enum class Balancing {
+  kNone,
+  kAvl
+};
+
+// Источник памяти под вершины. В режиме kPool вершины выделяются из больших
+// непрерывных слэбов, память удалённых вершин переиспользуется вставками, а
+// Clear() или разрушение дерева освобождают память целыми слэбами, не обходя
+// вершины. В режиме kHeap каждая вершина выделяется отдельно через Allocator.
+enum class NodeAllocation {
+  kHeap,
+  kPool
+};
+
+// Хранение равных ключей. В режиме kSeparateNodes каждый добавленный ключ
+// получает свою вершину, и равные ключи уходят в правое поддерево. В режиме
+// kCounted вершина хранит ключ и количество его вхождений: Add и Erase
+// существующего ключа лишь меняют счётчик, а дерево содержит по одной
+// вершине на каждый различный ключ.
+enum class Duplicates {
+  kSeparateNodes,
+  kCounted
+};
+
+// Дерево поиска с повторяющимися ключами, упорядоченными по Compare. Если
+// Compare прозрачен (объявляет is_transparent, как std::less<>), то Contains
+// и Erase принимают любой сравнимый с Key тип, например std::string_view для
+// ключей std::string, без построения временного ключа.
+template<typename Key, typename Compare = std::less<Key>,
+    typename Allocator = std::allocator<Key>>
+class BinarySearchTree {
+ protected:
+  struct Node;
+
+ public:
+  // Итератор обхода ключей в порядке неубывания, с учётом повторений.
+  // Переход к соседнему ключу идёт по указателям на родителей и сыновей,
+  // поэтому обход k подряд идущих ключей стоит O(глубины + k) и ничего не
+  // выделяет. Add не делает итераторы недействительными, Erase - только
+  // итераторы на ключи, равные удаляемому.
+  class ConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key *;
+    using reference = const Key &;
+
+    const Key &operator*() const;
+    const Key *operator->() const;
+
+    ConstIterator &operator++();
+    const ConstIterator operator++(int);
+
+    ConstIterator &operator--();
+    const ConstIterator operator--(int);
+
+    bool operator==(const ConstIterator &other) const;
+    bool operator!=(const ConstIterator &other) const;
+
+   private:
+    friend class BinarySearchTree;
+
+    ConstIterator(const BinarySearchTree *tree, Node *node);
+
+    const BinarySearchTree *tree_;
+    // nullptr для end()
+    Node *node_;
+    // Номер вхождения ключа вершины в режиме Duplicates::kCounted
+    int occurrence_;
+  };
+
+  // Полуинтервал итераторов, пригодный для range-based for
+  class ConstRange {
+   public:
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+   private:
+    friend class BinarySearchTree;
+
+    ConstRange(ConstIterator first, ConstIterator last);
+
+    ConstIterator first_;
+    ConstIterator last_;
+  };
+
+  explicit BinarySearchTree(Balancing balancing = Balancing::kNone,
+                            NodeAllocation allocation = NodeAllocation::kPool,
+                            Duplicates duplicates = Duplicates::kSeparateNodes,
+                            const Compare &compare = Compare(),
+                            const Allocator &allocator = Allocator());
+  ~BinarySearchTree();
+
+  BinarySearchTree(const BinarySearchTree &) = delete;
+  BinarySearchTree &operator=(const BinarySearchTree &) = delete;
+
+  bool Contains(const Key &value) const;
+  template<typename K, typename C = Compare, typename = typename C::is_transparent>
+  bool Contains(const K &value) const;
+
+  void Add(const Key &value);
+  void Add(Key &&value);
+
+  void Erase(const Key &value);
+  template<typename K, typename C = Compare, typename = typename C::is_transparent>
+  void Erase(const K &value);
+
+  int Size() const;
+  bool IsEmpty() const;
+  std::vector<Key> ToSortedArray() const;
+
+  // Передаёт visitor(const Key &) все ключи в порядке неубывания, с учётом
+  // повторений, не строя промежуточных массивов. Обход идёт без рекурсии:
+  // путь от корня до текущей вершины хранится в явном стеке из O(глубины
+  // дерева) указателей в куче, поэтому вырожденное дерево любой глубины не
+  // переполняет стек вызовов.
+  template<typename Visitor>
+  void VisitInOrder(Visitor &&visitor) const;
+
+  // Порядковые статистики за O(глубины дерева); ключи считаются с учётом
+  // повторений. Rank возвращает количество ключей, меньших value, Select -
+  // k-й по возрастанию ключ (с нуля) и бросает std::out_of_range при
+  // k вне [0, Size()), CountInRange - количество ключей из [lo, hi).
+  int Rank(const Key &value) const;
+  const Key &Select(int k) const;
+  int CountInRange(const Key &lo, const Key &hi) const;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  // Итераторы на первый ключ, не меньший value, и на первый ключ, больший
+  // value, соответственно; end(), если таких ключей нет. O(глубины дерева).
+  ConstIterator LowerBound(const Key &value) const;
+  ConstIterator UpperBound(const Key &value) const;
+  // Ключи из [lo, hi) в порядке неубывания
+  ConstRange Range(const Key &lo, const Key &hi) const;
+
+  // Удаляет все вершины без рекурсии, поэтому работает и на вырожденном
+  // дереве любой глубины
+  void Clear();
+
+  // Заменяет содержимое дерева ключами из упорядоченного по Compare диапазона
+  // и строит из них идеально сбалансированное дерево за O(n). В режиме
+  // NodeAllocation::kPool вершины размещаются в одном непрерывном блоке.
+  // Бросает std::invalid_argument, если диапазон не упорядочен; дерево при
+  // этом не меняется.
+  template<typename ForwardIterator>
+  void BuildFromSorted(ForwardIterator first, ForwardIterator last);
+
+  // Добавляет ключи из диапазона в любом порядке. Пачка сортируется; если
+  // k log n меньше n, ключи вставляются по одному, как через Add (в режиме
+  // Balancing::kNone - за O(глубины) каждый), иначе пачка сливается с
+  // имеющимися ключами, и дерево целиком перестраивается в идеально
+  // сбалансированное за O(n + k log k) без перевыделения имеющихся вершин.
+  // Новые вершины занимают в первую очередь освобождённые ячейки пула.
+  template<typename InputIterator>
+  void InsertBatch(InputIterator first, InputIterator last);
+
+  // Выгружает различные ключи дерева в неизменяемый индекс, оптимизированный
+  // для Contains; последующие изменения дерева на индекс не влияют
+  FrozenSearchIndex<Key, Compare> Freeze() const;
+
+ protected:
+  struct Node {
+    Key value;
+
+    Node *parent;
+    Node *left;
+    Node *right;
+
+    // Высота поддерева, образуемого вершиной; поддерживается только
+    // в режиме Balancing::kAvl
+    int height;
+
+    // Количество вхождений ключа; больше единицы только в режиме
+    // Duplicates::kCounted
+    int count;
+
+    // Количество ключей с учётом повторений в поддереве, образуемом вершиной
+    int subtree_size;
+
+    template<typename K>
+    Node(K &&value, Node *parent) : value(std::forward<K>(value)),
+                                    parent(parent),
+                                    left(nullptr), right(nullptr),
+                                    height(1), count(1), subtree_size(1) {}
+  };
+
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+  // Указатель на корневую вершину дерева и общее количество ключей с учётом
+  // повторений соответственно
+  Node *root_;
+  int size_;
+
+  Balancing balancing_;
+  Duplicates duplicates_;
+
+  Compare compare_;
+  NodeAllocator node_allocator_;
+  // nullptr в режиме NodeAllocation::kHeap
+  std::unique_ptr<SlabPool<Node, NodeAllocator>> pool_;
+
+  // Вспомогательные методы, создающие и удаляющие вершину с учётом источника
+  // памяти. DestroyNode не трогает связи вершины с остальным деревом.
+  template<typename K>
+  Node *CreateNode(K &&value, Node *parent);
+  void DestroyNode(Node *node);
+
+  template<typename K>
+  void Insert(K &&value);
+
+  // Убирает одно вхождение ключа вершины node; вершина с последним
+  // вхождением вырезается из дерева и удаляется
+  void EraseNode(Node *node);
+
+  // Обходит вершины в порядке неубывания ключей, храня путь от корня в куче
+  template<typename NodeVisitor>
+  void VisitNodesInOrder(NodeVisitor &&visitor) const;
+
+  // Создаёт несвязанные вершины для упорядоченного диапазона ключей и
+  // дописывает их в *nodes; в режиме Duplicates::kCounted равные ключи
+  // попадают в одну вершину. Возвращает количество ключей диапазона. При
+  // исключении созданные вершины удаляются, а *nodes не меняется.
+  template<typename ForwardIterator>
+  int CreateSortedNodes(ForwardIterator first, ForwardIterator last,
+                        std::vector<Node *> *nodes);
+
+  // Связывает count упорядоченных вершин в идеально сбалансированное
+  // поддерево с родителем parent и возвращает его корень
+  Node *LinkBalanced(Node *const *nodes, int count, Node *parent);
+
+  // Вспомогательный метод, возвращающий указатель на одну из вершин со
+  // значением 'value' (любую из них), либо nullptr при отсутствии таких вершин.
+  template<typename K>
+  Node *Find(const K &value) const;
+
+  // Вспомогательный метод, позволяющий "отвязать" вершину от дерева поиска.
+  // После выполнения данной операции, вершина 'target_node' перестаёт входить
+  // в поддерево, образуемое вершиной 'root_', но удаления данной вершины не
+  // происходит.
+  void Detach(Node *target_node);
+
+  // Вспомагательный метод, который вставляет узел target_node
+  // в дерево вместо узла node.
+  // Последний полностью вырезается из дерева
+  void ReplaceNode(Node *node, Node *target_node);
+
+  // Вспомогательные методы, которые позволяют получать указатели на самую
+  // левую и самую правую вершины в поддереве, образуемом вершиной node,
+  // соответствтенно.
+  Node *GetLeftmostNode(Node *node) const;
+  Node *GetRightmostNode(Node *node) const;
+
+  // Вспомогательные методы, возвращающие следующую и предыдущую вершины
+  // при обходе в порядке неубывания, либо nullptr при их отсутствии.
+  static Node *GetNextNode(Node *node);
+  static Node *GetPreviousNode(Node *node);
+
+  // Вспомогательные методы, поддерживающие размеры поддеревьев. AddToPath
+  // прибавляет delta к размерам поддеревьев вершины node и всех её предков.
+  static int SubtreeSize(const Node *node);
+  static void UpdateSubtreeSize(Node *node);
+  static void AddToPath(Node *node, int delta);
+
+  // Вспомогательные методы AVL-балансировки. Повороты сохраняют порядок
+  // вершин при обходе, поэтому равные значения могут оказаться в обоих
+  // поддеревьях, и Find по-прежнему находит одну из таких вершин.
+  static int Height(const Node *node);
+  static void UpdateHeight(Node *node);
+  void RotateLeft(Node *node);
+  void RotateRight(Node *node);
+
+  // Восстанавливает балансировку на пути от вершины node до корня.
+  void Rebalance(Node *node);
+};
+
+template<typename Key, typename Compare, typename Allocator>
+BinarySearchTree<Key, Compare, Allocator>::BinarySearchTree
+    (Balancing balancing, NodeAllocation allocation, Duplicates duplicates,
+     const Compare &compare, const Allocator &allocator)
+    : root_(nullptr), size_(0), balancing_(balancing), duplicates_(duplicates),
+      compare_(compare), node_allocator_(allocator) {
+  if (allocation == NodeAllocation::kPool) {
+    pool_.reset(new SlabPool<Node, NodeAllocator>(node_allocator_));
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+BinarySearchTree<Key, Compare, Allocator>::~BinarySearchTree() {
+  Clear();
+}
+
+template<typename Key, typename Compare, typename Allocator>
+BinarySearchTree<Key, Compare, Allocator>::ConstIterator::ConstIterator
+    (const BinarySearchTree *tree, Node *node)
+    : tree_(tree), node_(node), occurrence_(0) {}
+
+template<typename Key, typename Compare, typename Allocator>
+const Key &BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator*() const {
+  if (node_ == nullptr) {
+    throw std::invalid_argument("operator* from end() iterator");
+  }
+  return node_->value;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+const Key *BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator->() const {
+  return &**this;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator &
+BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator++() {
+  if (node_ == nullptr) {
+    throw std::out_of_range("Trying to increment end() iterator");
+  }
+  if (occurrence_ + 1 < node_->count) {
+    ++occurrence_;
+  } else {
+    node_ = GetNextNode(node_);
+    occurrence_ = 0;
+  }
+  return *this;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+const typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator &
+BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator--() {
+  if (node_ != nullptr && occurrence_ > 0) {
+    --occurrence_;
+    return *this;
+  }
+  Node *previous = (node_ != nullptr) ? GetPreviousNode(node_) :
+                   (tree_->root_ != nullptr) ? tree_->GetRightmostNode(tree_->root_) :
+                   nullptr;
+  if (previous == nullptr) {
+    throw std::out_of_range("Trying to decrement begin() iterator");
+  }
+  node_ = previous;
+  occurrence_ = node_->count - 1;
+  return *this;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+const typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+bool BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator==
+    (const ConstIterator &other) const {
+  return node_ == other.node_ && occurrence_ == other.occurrence_;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+bool BinarySearchTree<Key, Compare, Allocator>::ConstIterator::operator!=
+    (const ConstIterator &other) const {
+  return !(*this == other);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+BinarySearchTree<Key, Compare, Allocator>::ConstRange::ConstRange
+    (ConstIterator first, ConstIterator last)
+    : first_(first), last_(last) {}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::ConstRange::begin() const {
+  return first_;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::ConstRange::end() const {
+  return last_;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+bool BinarySearchTree<Key, Compare, Allocator>::Contains(const Key &value) const {
+  return Find(value) != nullptr;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename K, typename C, typename>
+bool BinarySearchTree<Key, Compare, Allocator>::Contains(const K &value) const {
+  return Find(value) != nullptr;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Add(const Key &value) {
+  Insert(value);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Add(Key &&value) {
+  Insert(std::move(value));
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Erase(const Key &value) {
+  Node *node = Find(value);
+  if (node == nullptr) return;
+  EraseNode(node);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename K, typename C, typename>
+void BinarySearchTree<Key, Compare, Allocator>::Erase(const K &value) {
+  Node *node = Find(value);
+  if (node == nullptr) return;
+  EraseNode(node);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+int BinarySearchTree<Key, Compare, Allocator>::Size() const {
+  return size_;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+bool BinarySearchTree<Key, Compare, Allocator>::IsEmpty() const {
+  return Size() == 0;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+std::vector<Key> BinarySearchTree<Key, Compare, Allocator>::ToSortedArray() const {
+  std::vector<Key> buffer;
+  buffer.reserve(size_);
+  VisitInOrder([&buffer](const Key &value) {
+    buffer.push_back(value);
+  });
+  return buffer;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename Visitor>
+void BinarySearchTree<Key, Compare, Allocator>::VisitInOrder(Visitor &&visitor) const {
+  VisitNodesInOrder([&visitor](const Node *node) {
+    for (int i = 0; i < node->count; ++i) {
+      visitor(static_cast<const Key &>(node->value));
+    }
+  });
+}
+
+template<typename Key, typename Compare, typename Allocator>
+int BinarySearchTree<Key, Compare, Allocator>::Rank(const Key &value) const {
+  int rank = 0;
+  Node *node = root_;
+  while (node != nullptr) {
+    if (compare_(node->value, value)) {
+      rank += SubtreeSize(node->left) + node->count;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return rank;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+const Key &BinarySearchTree<Key, Compare, Allocator>::Select(int k) const {
+  if (k < 0 || k >= size_) {
+    throw std::out_of_range("k is out of range");
+  }
+  Node *node = root_;
+  while (true) {
+    int left_size = SubtreeSize(node->left);
+    if (k < left_size) {
+      node = node->left;
+    } else if (k < left_size + node->count) {
+      return node->value;
+    } else {
+      k -= left_size + node->count;
+      node = node->right;
+    }
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+int BinarySearchTree<Key, Compare, Allocator>::CountInRange
+    (const Key &lo, const Key &hi) const {
+  if (!compare_(lo, hi)) return 0;
+  return Rank(hi) - Rank(lo);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::begin() const {
+  return ConstIterator(this, (root_ != nullptr) ? GetLeftmostNode(root_) : nullptr);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::end() const {
+  return ConstIterator(this, nullptr);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::LowerBound(const Key &value) const {
+  Node *result = nullptr, *node = root_;
+  while (node != nullptr) {
+    if (compare_(node->value, value)) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
+  }
+  return ConstIterator(this, result);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstIterator
+BinarySearchTree<Key, Compare, Allocator>::UpperBound(const Key &value) const {
+  Node *result = nullptr, *node = root_;
+  while (node != nullptr) {
+    if (compare_(value, node->value)) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return ConstIterator(this, result);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::ConstRange
+BinarySearchTree<Key, Compare, Allocator>::Range(const Key &lo, const Key &hi) const {
+  ConstIterator first = LowerBound(lo);
+  if (!compare_(lo, hi)) {
+    return ConstRange(first, first);
+  }
+  return ConstRange(first, LowerBound(hi));
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Clear() {
+  // Тривиально разрушаемые вершины из пула обходить не нужно, достаточно
+  // вернуть слэбы
+  if (pool_ == nullptr || !std::is_trivially_destructible<Node>::value) {
+    // Поворачиваем дерево вправо, пока у текущей вершины есть левый сын;
+    // вершину без левого сына удаляем и переходим к правому. Каждая вершина
+    // поворачивается не более одного раза, так что обход линейный и не
+    // требует дополнительной памяти.
+    Node *node = root_;
+    while (node != nullptr) {
+      if (node->left != nullptr) {
+        Node *left = node->left;
+        node->left = left->right;
+        left->right = node;
+        node = left;
+      } else {
+        Node *right = node->right;
+        DestroyNode(node);
+        node = right;
+      }
+    }
+  }
+  if (pool_ != nullptr) {
+    pool_->ReleaseAll();
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename ForwardIterator>
+void BinarySearchTree<Key, Compare, Allocator>::BuildFromSorted
+    (ForwardIterator first, ForwardIterator last) {
+  if (!std::is_sorted(first, last, compare_)) {
+    throw std::invalid_argument("BuildFromSorted expects a sorted range");
+  }
+
+  Clear();
+  std::vector<Node *> nodes;
+  int added = CreateSortedNodes(first, last, &nodes);
+  root_ = LinkBalanced(nodes.data(), static_cast<int>(nodes.size()), nullptr);
+  size_ = added;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename InputIterator>
+void BinarySearchTree<Key, Compare, Allocator>::InsertBatch
+    (InputIterator first, InputIterator last) {
+  std::vector<Key> batch(first, last);
+  if (batch.empty()) return;
+  std::sort(batch.begin(), batch.end(), compare_);
+
+  // Вставка по одному ключу стоит O(k log n), перестройка - O(n + k log k)
+  int depth = 1;
+  for (size_t count = size_ + batch.size(); count > 1; count /= 2) {
+    ++depth;
+  }
+  if (batch.size() * depth < static_cast<size_t>(size_)) {
+    for (Key &key : batch) {
+      Insert(std::move(key));
+    }
+    return;
+  }
+
+  std::vector<Node *> existing;
+  existing.reserve(size_);
+  VisitNodesInOrder([&existing](Node *node) {
+    existing.push_back(node);
+  });
+
+  // В режиме Duplicates::kCounted уже имеющиеся ключи лишь увеличивают
+  // счётчики своих вершин; это делается после создания новых вершин, чтобы
+  // исключение не оставило дерево изменённым
+  std::vector<Node *> counted_nodes;
+  std::vector<Key> fresh;
+  if (duplicates_ == Duplicates::kCounted) {
+    auto node_it = existing.begin();
+    for (Key &key : batch) {
+      while (node_it != existing.end() && compare_((*node_it)->value, key)) {
+        ++node_it;
+      }
+      if (node_it != existing.end() && !compare_(key, (*node_it)->value)) {
+        counted_nodes.push_back(*node_it);
+      } else {
+        fresh.push_back(std::move(key));
+      }
+    }
+  } else {
+    fresh = std::move(batch);
+  }
+
+  // Всё, что может бросить исключение, выделяется до создания вершин, чтобы
+  // созданные вершины не остались ни к чему не привязанными
+  std::vector<Node *> merged;
+  merged.reserve(existing.size() + fresh.size());
+  std::vector<Node *> created;
+  int added = CreateSortedNodes(std::make_move_iterator(fresh.begin()),
+                                std::make_move_iterator(fresh.end()), &created);
+  std::merge(existing.begin(), existing.end(), created.begin(), created.end(),
+             std::back_inserter(merged), [this](const Node *lhs, const Node *rhs) {
+        return compare_(lhs->value, rhs->value);
+      });
+
+  for (Node *node : counted_nodes) {
+    ++node->count;
+  }
+  root_ = LinkBalanced(merged.data(), static_cast<int>(merged.size()), nullptr);
+  size_ += added + static_cast<int>(counted_nodes.size());
+}
+
+template<typename Key, typename Compare, typename Allocator>
+FrozenSearchIndex<Key, Compare> BinarySearchTree<Key, Compare, Allocator>::Freeze() const {
+  std::vector<Key> distinct;
+  VisitNodesInOrder([this, &distinct](const Node *node) {
+    if (distinct.empty() || compare_(distinct.back(), node->value)) {
+      distinct.push_back(node->value);
+    }
+  });
+  return FrozenSearchIndex<Key, Compare>(std::make_move_iterator(distinct.begin()),
+                                         std::make_move_iterator(distinct.end()),
+                                         compare_);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename K>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::CreateNode(K &&value, Node *parent) {
+  Node *node = (pool_ != nullptr) ?
+               static_cast<Node *>(pool_->Allocate()) :
+               NodeAllocatorTraits::allocate(node_allocator_, 1);
+  try {
+    NodeAllocatorTraits::construct(node_allocator_, node,
+                                   std::forward<K>(value), parent);
+  } catch (...) {
+    if (pool_ != nullptr) {
+      pool_->Deallocate(node);
+    } else {
+      NodeAllocatorTraits::deallocate(node_allocator_, node, 1);
+    }
+    throw;
+  }
+  return node;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::DestroyNode(Node *node) {
+  NodeAllocatorTraits::destroy(node_allocator_, node);
+  if (pool_ != nullptr) {
+    pool_->Deallocate(node);
+  } else {
+    NodeAllocatorTraits::deallocate(node_allocator_, node, 1);
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename K>
+void BinarySearchTree<Key, Compare, Allocator>::Insert(K &&value) {
+  Node *prev = nullptr, *node = root_;
+  bool to_left = false;
+  while (node != nullptr) {
+    prev = node;
+    to_left = compare_(value, node->value);
+    if (!to_left && duplicates_ == Duplicates::kCounted &&
+        !compare_(node->value, value)) {
+      ++node->count;
+      AddToPath(node, 1);
+      ++size_;
+      return;
+    }
+    node = to_left ? node->left : node->right;
+  }
+
+  Node *temp = CreateNode(std::forward<K>(value), prev);
+  if (prev == nullptr) {
+    root_ = temp;
+  } else if (to_left) {
+    prev->left = temp;
+  } else {
+    prev->right = temp;
+  }
+  AddToPath(prev, 1);
+  ++size_;
+
+  if (balancing_ == Balancing::kAvl) {
+    Rebalance(temp->parent);
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::EraseNode(Node *node) {
+  if (node->count > 1) {
+    --node->count;
+    AddToPath(node, -1);
+    --size_;
+    return;
+  }
+
+  Node *removing_node = (node->left == nullptr || node->right == nullptr) ?
+                        node : GetLeftmostNode(node->right);
+
+  Node *any_kid = (removing_node->left) ?
+                  removing_node->left : removing_node->right;
+
+  Node *parent = removing_node->parent;
+  // Высоты меняются только на пути от места фактического удаления до корня
+  Node *rebalance_from = (parent == node) ? removing_node : parent;
+  // Ключи removing_node поднимаются на место node и выходят из поддеревьев
+  // вершин между ними; размер node за вычетом удаляемого ключа переходит
+  // к removing_node в ReplaceNode
+  if (node != removing_node) {
+    for (Node *ancestor = parent; ancestor != node; ancestor = ancestor->parent) {
+      ancestor->subtree_size -= removing_node->count;
+    }
+  }
+  AddToPath(node, -1);
+  if (any_kid != nullptr) {
+    any_kid->parent = parent;
+  }
+
+  if (parent == nullptr) {
+    root_ = any_kid;
+  } else {
+    if (parent->left == removing_node) {
+      parent->left = any_kid;
+    } else {
+      parent->right = any_kid;
+    }
+  }
+
+  if (node != removing_node) {
+    ReplaceNode(node, removing_node);
+    if (root_ == node) {
+      root_ = removing_node;
+    }
+  }
+  Detach(node);
+  DestroyNode(node);
+  --size_;
+
+  if (balancing_ == Balancing::kAvl) {
+    Rebalance(rebalance_from);
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename NodeVisitor>
+void BinarySearchTree<Key, Compare, Allocator>::VisitNodesInOrder
+    (NodeVisitor &&visitor) const {
+  // Путь от корня хранится в куче, а не на стеке вызовов, поэтому глубина
+  // дерева ограничена только памятью
+  std::vector<Node *> path;
+  Node *node = root_;
+  while (node != nullptr || !path.empty()) {
+    while (node != nullptr) {
+      path.push_back(node);
+      node = node->left;
+    }
+    node = path.back();
+    path.pop_back();
+    Node *right = node->right;
+    visitor(node);
+    node = right;
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename ForwardIterator>
+int BinarySearchTree<Key, Compare, Allocator>::CreateSortedNodes
+    (ForwardIterator first, ForwardIterator last, std::vector<Node *> *nodes) {
+  size_t distinct_count = 0;
+  for (ForwardIterator it = first, previous = first; it != last; previous = it++) {
+    if (duplicates_ != Duplicates::kCounted || it == first ||
+        compare_(*previous, *it)) {
+      ++distinct_count;
+    }
+  }
+  if (distinct_count == 0) return 0;
+
+  // После резервирования push_back не бросает исключений
+  nodes->reserve(nodes->size() + distinct_count);
+  const size_t first_created = nodes->size();
+
+  // Вершины в первую очередь занимают свободные ячейки пула, и только
+  // недостающие, если их не меньше слэба, размещаются в отдельном блоке.
+  // Так после Clear() вся пачка ложится в один непрерывный блок, а пачки
+  // вставок, чередующиеся с удалениями, не заводят новых слэбов.
+  size_t block_size = 0;
+  if (pool_ != nullptr) {
+    size_t free_count = pool_->FreeCount();
+    if (distinct_count > free_count &&
+        distinct_count - free_count >= pool_->SlabSize()) {
+      block_size = distinct_count - free_count;
+    }
+  }
+  Node *block = (block_size != 0) ? pool_->AllocateBlock(block_size) : nullptr;
+  const size_t first_in_block = first_created + distinct_count - block_size;
+  int added = 0;
+  try {
+    for (; first != last; ++first, ++added) {
+      if (duplicates_ == Duplicates::kCounted && nodes->size() > first_created &&
+          !compare_(nodes->back()->value, *first)) {
+        ++nodes->back()->count;
+      } else if (nodes->size() >= first_in_block) {
+        Node *node = block + (nodes->size() - first_in_block);
+        NodeAllocatorTraits::construct(node_allocator_, node, *first, nullptr);
+        nodes->push_back(node);
+      } else {
+        nodes->push_back(CreateNode(*first, nullptr));
+      }
+    }
+  } catch (...) {
+    for (size_t i = first_created; i < nodes->size(); ++i) {
+      DestroyNode((*nodes)[i]);
+    }
+    if (block != nullptr) {
+      size_t used_in_block =
+          (nodes->size() > first_in_block) ? nodes->size() - first_in_block : 0;
+      for (size_t i = used_in_block; i < block_size; ++i) {
+        pool_->Deallocate(block + i);
+      }
+    }
+    nodes->resize(first_created);
+    throw;
+  }
+  return added;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::LinkBalanced
+    (Node *const *nodes, int count, Node *parent) {
+  if (count == 0) return nullptr;
+
+  int middle = count / 2;
+  Node *node = nodes[middle];
+  node->parent = parent;
+  node->left = LinkBalanced(nodes, middle, node);
+  node->right = LinkBalanced(nodes + middle + 1, count - middle - 1, node);
+  UpdateHeight(node);
+  UpdateSubtreeSize(node);
+  return node;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+template<typename K>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::Find(const K &value) const {
+  Node *node = root_;
+  while (node != nullptr) {
+    if (compare_(value, node->value)) {
+      node = node->left;
+    } else if (compare_(node->value, value)) {
+      node = node->right;
+    } else {
+      break;
+    }
+  }
+  return node;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Detach(Node *target_node) {
+  target_node->left = target_node->right
+      = target_node->parent = nullptr;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::ReplaceNode
+    (Node *node, Node *target_node) {
+  target_node->subtree_size = node->subtree_size;
+
+  target_node->left = node->left;
+  if (node->left != nullptr) {
+    node->left->parent = target_node;
+  }
+
+  target_node->right = node->right;
+  if (node->right != nullptr) {
+    node->right->parent = target_node;
+  }
+
+  target_node->parent = node->parent;
+  if (node->parent != nullptr) {
+    if (node == node->parent->left) {
+      node->parent->left = target_node;
+    } else {
+      node->parent->right = target_node;
+    }
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::GetLeftmostNode(Node *node) const {
+  while (node->left != nullptr) {
+    node = node->left;
+  }
+  return node;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::GetRightmostNode(Node *node) const {
+  while (node->right != nullptr) {
+    node = node->right;
+  }
+  return node;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::GetNextNode(Node *node) {
+  if (node->right != nullptr) {
+    node = node->right;
+    while (node->left != nullptr) {
+      node = node->left;
+    }
+    return node;
+  }
+  while (node->parent != nullptr && node == node->parent->right) {
+    node = node->parent;
+  }
+  return node->parent;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+typename BinarySearchTree<Key, Compare, Allocator>::Node *
+BinarySearchTree<Key, Compare, Allocator>::GetPreviousNode(Node *node) {
+  if (node->left != nullptr) {
+    node = node->left;
+    while (node->right != nullptr) {
+      node = node->right;
+    }
+    return node;
+  }
+  while (node->parent != nullptr && node == node->parent->left) {
+    node = node->parent;
+  }
+  return node->parent;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+int BinarySearchTree<Key, Compare, Allocator>::SubtreeSize(const Node *node) {
+  return (node != nullptr) ? node->subtree_size : 0;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::UpdateSubtreeSize(Node *node) {
+  node->subtree_size =
+      SubtreeSize(node->left) + node->count + SubtreeSize(node->right);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::AddToPath(Node *node, int delta) {
+  while (node != nullptr) {
+    node->subtree_size += delta;
+    node = node->parent;
+  }
+}
+
+template<typename Key, typename Compare, typename Allocator>
+int BinarySearchTree<Key, Compare, Allocator>::Height(const Node *node) {
+  return (node != nullptr) ? node->height : 0;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::UpdateHeight(Node *node) {
+  node->height = std::max(Height(node->left), Height(node->right)) + 1;
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::RotateLeft(Node *node) {
+  Node *pivot = node->right;
+
+  node->right = pivot->left;
+  if (pivot->left != nullptr) {
+    pivot->left->parent = node;
+  }
+
+  pivot->parent = node->parent;
+  if (node->parent == nullptr) {
+    root_ = pivot;
+  } else if (node == node->parent->left) {
+    node->parent->left = pivot;
+  } else {
+    node->parent->right = pivot;
+  }
+
+  pivot->left = node;
+  node->parent = pivot;
+
+  UpdateHeight(node);
+  UpdateHeight(pivot);
+  UpdateSubtreeSize(node);
+  UpdateSubtreeSize(pivot);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::RotateRight(Node *node) {
+  Node *pivot = node->left;
+
+  node->left = pivot->right;
+  if (pivot->right != nullptr) {
+    pivot->right->parent = node;
+  }
+
+  pivot->parent = node->parent;
+  if (node->parent == nullptr) {
+    root_ = pivot;
+  } else if (node == node->parent->left) {
+    node->parent->left = pivot;
+  } else {
+    node->parent->right = pivot;
+  }
+
+  pivot->right = node;
+  node->parent = pivot;
+
+  UpdateHeight(node);
+  UpdateHeight(pivot);
+  UpdateSubtreeSize(node);
+  UpdateSubtreeSize(pivot);
+}
+
+template<typename Key, typename Compare, typename Allocator>
+void BinarySearchTree<Key, Compare, Allocator>::Rebalance(Node *node) {
+  while (node != nullptr) {
+    UpdateHeight(node);
+    int balance = Height(node->left) - Height(node->right);
+    if (balance > 1) {
+      if (Height(node->left->left) < Height(node->left->right)) {
+        RotateLeft(node->left);
+      }
+      RotateRight(node);
+      node = node->parent;
+    } else if (balance < -1) {
+      if (Height(node->right->right) < Height(node->right->left)) {
+        RotateRight(node->right);
+      }
+      RotateLeft(node);
+      node = node->parent;
+    }
+    node = node->parent;
+  }
+}
+
+#endif //BINARYSEARCHTREE_BINARY_SEARCH_TREE_H
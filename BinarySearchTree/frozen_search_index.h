@@ -0,0 +1,120 @@
+#ifndef BINARYSEARCHTREE_FROZEN_SEARCH_INDEX_H
+#define BINARYSEARCHTREE_FROZEN_SEARCH_INDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// Неизменяемый индекс для поиска по упорядоченному набору ключей. Ключи
+// хранятся в одном массиве в порядке Эйтцингера: корень неявного дерева
+// в позиции 1, сыновья вершины k - в позициях 2k и 2k + 1. Верхние уровни
+// дерева лежат рядом в начале массива и остаются в кэше, а следующий шаг
+// поиска зависит только от результата сравнения, поэтому Contains обходится
+// без ветвлений и с заранее загруженными строками кэша.
+template<typename Key, typename Compare = std::less<Key>>
+class FrozenSearchIndex {
+ public:
+  // Диапазон [first, last) должен быть упорядочен по Compare
+  template<typename ForwardIterator>
+  FrozenSearchIndex(ForwardIterator first, ForwardIterator last,
+                    const Compare &compare = Compare());
+
+  bool Contains(const Key &value) const;
+  template<typename K, typename C = Compare, typename = typename C::is_transparent>
+  bool Contains(const K &value) const;
+
+  int Size() const;
+  bool IsEmpty() const;
+
+ private:
+  // Сколько ключей помещается в строку кэша; на столько уровней вперёд
+  // загружаются потомки текущей вершины
+  static const size_t kKeysPerCacheLine =
+      (sizeof(Key) < 64) ? 64 / sizeof(Key) : 1;
+
+  // Ключ позиции k неявного дерева хранится в keys_[k - 1]
+  std::vector<Key> keys_;
+  Compare compare_;
+
+  // Записывает в order[k] номер ключа в упорядоченном диапазоне для всех
+  // позиций поддерева с корнем k; возвращает следующий свободный номер.
+  // Глубина рекурсии равна высоте неявного дерева, то есть O(log n).
+  static size_t FillOrder(std::vector<size_t> *order, size_t k, size_t index);
+
+  // Позиция первого ключа, не меньшего value, либо 0, если таких нет
+  template<typename K>
+  size_t LowerBoundPosition(const K &value) const;
+};
+
+template<typename Key, typename Compare>
+template<typename ForwardIterator>
+FrozenSearchIndex<Key, Compare>::FrozenSearchIndex
+    (ForwardIterator first, ForwardIterator last, const Compare &compare)
+    : compare_(compare) {
+  std::vector<ForwardIterator> sorted;
+  for (; first != last; ++first) {
+    sorted.push_back(first);
+  }
+
+  std::vector<size_t> order(sorted.size() + 1);
+  FillOrder(&order, 1, 0);
+  keys_.reserve(sorted.size());
+  for (size_t k = 1; k <= sorted.size(); ++k) {
+    keys_.push_back(*sorted[order[k]]);
+  }
+}
+
+template<typename Key, typename Compare>
+bool FrozenSearchIndex<Key, Compare>::Contains(const Key &value) const {
+  size_t position = LowerBoundPosition(value);
+  return position != 0 && !compare_(value, keys_[position - 1]);
+}
+
+template<typename Key, typename Compare>
+template<typename K, typename C, typename>
+bool FrozenSearchIndex<Key, Compare>::Contains(const K &value) const {
+  size_t position = LowerBoundPosition(value);
+  return position != 0 && !compare_(value, keys_[position - 1]);
+}
+
+template<typename Key, typename Compare>
+int FrozenSearchIndex<Key, Compare>::Size() const {
+  return static_cast<int>(keys_.size());
+}
+
+template<typename Key, typename Compare>
+bool FrozenSearchIndex<Key, Compare>::IsEmpty() const {
+  return keys_.empty();
+}
+
+template<typename Key, typename Compare>
+size_t FrozenSearchIndex<Key, Compare>::FillOrder
+    (std::vector<size_t> *order, size_t k, size_t index) {
+  if (k < order->size()) {
+    index = FillOrder(order, 2 * k, index);
+    (*order)[k] = index++;
+    index = FillOrder(order, 2 * k + 1, index);
+  }
+  return index;
+}
+
+template<typename Key, typename Compare>
+template<typename K>
+size_t FrozenSearchIndex<Key, Compare>::LowerBoundPosition(const K &value) const {
+  const size_t size = keys_.size();
+  const Key *keys = keys_.data();
+
+  size_t k = 1;
+  while (k <= size) {
+    // Потомки вершины k через log2(kKeysPerCacheLine) уровней лежат подряд
+    __builtin_prefetch(keys + k * kKeysPerCacheLine);
+    k = 2 * k + compare_(keys[k - 1], value);
+  }
+  // Младшие единичные биты k - спуски вправо от ключей, меньших value, а
+  // ближайший к ним нулевой бит - спуск влево от искомого ключа. Отбрасываем
+  // их, возвращаясь к нему; если спусков влево не было, получится 0.
+  k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+  return k;
+}
+
+#endif //BINARYSEARCHTREE_FROZEN_SEARCH_INDEX_H
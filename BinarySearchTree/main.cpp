@@ -1,217 +1,93 @@
 #include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <cassert>
+#include <cstdlib>
 #include <random>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
+#include <stdexcept>
 
-class BinarySearchTree {
- public:
-  BinarySearchTree();
-  ~BinarySearchTree();
-  bool Contains(int value) const;
-  void Add(int value);
-  void Erase(int value);
-  int Size() const;
-  bool IsEmpty() const;
-  std::vector<int> ToSortedArray() const;
-
- protected:
-  struct Node {
-    int value;
-
-    Node *parent;
-    Node *left;
-    Node *right;
-
-    Node(int value, Node *parent) : value(value), parent(parent),
-                                    left(nullptr), right(nullptr) {}
-
-    ~Node() {
-      delete left;
-      delete right;
-    }
-  };
-
-  // Указатель на корневую вершину дерева и общее количество вершин соответственно
-  Node *root_;
-  int size_;
-
-  // Вспомогательный метод, возвращающий указатель на одну из вершин со
-  // значением 'value' (любую из них), либо nullptr при отсутствии таких вершин.
-  Node *Find(int value) const;
-
-  // Вспомогательный метод, позволяющий "отвязать" вершину от дерева поиска.
-  // После выполнения данной операции, вершина 'target_node' перестаёт входить
-  // в поддерево, образуемое вершиной 'root_', но удаления данной вершины не
-  // происходит.
-  void Detach(Node *target_node);
-
-  // Вспомагательный метод, который вставляет узел target_node
-  // в дерево вместо узла node.
-  // Последний полностью вырезается из дерева
-  void ReplaceNode(Node *node, Node *target_node);
-
-  // Вспомогательные методы, которые позволяют получать указатели на самую
-  // левую и самую правую вершины в поддереве, образуемом вершиной node,
-  // соответствтенно.
-  Node *GetLeftmostNode(Node *node) const;
-  Node *GetRightmostNode(Node *node) const;
-
-  // Вспомогательные метод, дописывающий все элементы в поддереве, образуемом
-  // вершиной node, в конец вектора *res в порядке неубывания хранимых значений.
-  void AppendToSortedArray(Node *node, std::vector<int> *res) const;
-};
-
-BinarySearchTree::BinarySearchTree() : root_(nullptr), size_(0) {}
-
-BinarySearchTree::~BinarySearchTree() {
-  delete root_;
-}
-
-bool BinarySearchTree::Contains(int value) const {
-  return Find(value) != nullptr;
-}
-
-void BinarySearchTree::Add(int value) {
-  Node *temp = new Node{value, nullptr};
-
-  if (!IsEmpty()) {
-    Node *prev = nullptr, *node = root_;
-    while (node != nullptr) {
-      prev = node;
-      node = (value < node->value) ?
-             node->left : node->right;
-    }
-
-    temp->parent = prev;
-    if (value < prev->value) {
-      prev->left = temp;
-    } else {
-      prev->right = temp;
-    }
-  } else {
-    root_ = temp;
-  }
-  ++size_;
-}
-
-void BinarySearchTree::Erase(int value) {
-  Node *node = Find(value);
-  if (node == nullptr) return;
-
-  Node *removing_node = (node->left == nullptr || node->right == nullptr) ?
-                        node : GetLeftmostNode(node->right);
-
-  Node *any_kid = (removing_node->left) ?
-                  removing_node->left : removing_node->right;
-
-  Node *parent = removing_node->parent;
-  if (any_kid != nullptr) {
-    any_kid->parent = parent;
-  }
+#include "binary_search_tree.h"
 
-  if (parent == nullptr) {
-    root_ = any_kid;
-  } else {
-    if (parent->left == removing_node) {
-      parent->left = any_kid;
-    } else {
-      parent->right = any_kid;
+// Дерево, которое умеет проверять свои инварианты: связи вершин с родителями,
+// в режиме Balancing::kAvl высоты и сбалансированность поддеревьев, а в режиме
+// Duplicates::kCounted различность ключей и счётчики вхождений.
+class CheckedBinarySearchTree : public BinarySearchTree<int> {
+ public:
+  CheckedBinarySearchTree(Balancing balancing, NodeAllocation allocation,
+                          Duplicates duplicates = Duplicates::kSeparateNodes)
+      : BinarySearchTree(balancing, allocation, duplicates) {}
+
+  // Дописывает справа цепочку из count вершин за O(count), минуя Add,
+  // на котором такое дерево строилось бы за квадратичное время
+  void AppendDegenerateChain(int count) {
+    Node *last = (root_ != nullptr) ? GetRightmostNode(root_) : nullptr;
+    for (int i = 0; i < count; ++i) {
+      int value = (last != nullptr) ? last->value + 1 : 0;
+      Node *node = CreateNode(value, last);
+      if (last == nullptr) {
+        root_ = node;
+      } else {
+        last->right = node;
+      }
+      last = node;
+      ++size_;
     }
-  }
-
-  if (node != removing_node) {
-    ReplaceNode(node, removing_node);
-    if (root_ == node) {
-      root_ = removing_node;
+    for (Node *node = last; node != nullptr; node = node->parent) {
+      UpdateSubtreeSize(node);
     }
   }
-  Detach(node);
-  delete node;
-  --size_;
-}
-
-int BinarySearchTree::Size() const {
-  return size_;
-}
-
-bool BinarySearchTree::IsEmpty() const {
-  return Size() == 0;
-}
-
-std::vector<int> BinarySearchTree::ToSortedArray() const {
-  std::vector<int> buffer;
-  if (IsEmpty()) return buffer;
 
-  AppendToSortedArray(root_, &buffer);
-  return buffer;
-}
-
-BinarySearchTree::Node *BinarySearchTree::Find(int value) const {
-  Node *node = root_;
-  while (node != nullptr && node->value != value) {
-    node = (value < node->value) ?
-           node->left : node->right;
+  size_t PoolSlabsCount() const {
+    return (pool_ != nullptr) ? pool_->SlabsCount() : 0;
   }
-  return node;
-}
-
-void BinarySearchTree::Detach(Node *target_node) {
-  target_node->left = target_node->right
-      = target_node->parent = nullptr;
-}
 
-void BinarySearchTree::ReplaceNode(Node *node, Node *target_node) {
-  target_node->left = node->left;
-  if (node->left != nullptr) {
-    node->left->parent = target_node;
+  void CheckInvariants() const {
+    assert(root_ == nullptr || root_->parent == nullptr);
+    assert(SubtreeSize(root_) == size_);
+    CheckSubtree(root_);
   }
 
-  target_node->right = node->right;
-  if (node->right != nullptr) {
-    node->right->parent = target_node;
-  }
+ private:
+  // Возвращает высоту поддерева, образуемого вершиной node
+  int CheckSubtree(const Node *node) const {
+    if (node == nullptr) return 0;
 
-  target_node->parent = node->parent;
-  if (node->parent != nullptr) {
-    if (node == node->parent->left) {
-      node->parent->left = target_node;
+    if (node->left != nullptr) {
+      assert(node->left->parent == node);
+      assert(node->left->value <= node->value);
+    }
+    if (node->right != nullptr) {
+      assert(node->right->parent == node);
+      assert(node->value <= node->right->value);
+    }
+    if (duplicates_ == Duplicates::kCounted) {
+      assert(node->count >= 1);
+      assert(node->left == nullptr || node->left->value < node->value);
+      assert(node->right == nullptr || node->value < node->right->value);
     } else {
-      node->parent->right = target_node;
+      assert(node->count == 1);
     }
+    assert(node->subtree_size ==
+        SubtreeSize(node->left) + node->count + SubtreeSize(node->right));
+
+    int left_height = CheckSubtree(node->left);
+    int right_height = CheckSubtree(node->right);
+    int height = std::max(left_height, right_height) + 1;
+    if (balancing_ == Balancing::kAvl) {
+      assert(node->height == height);
+      assert(std::abs(left_height - right_height) <= 1);
+    }
+    return height;
   }
-}
-
-BinarySearchTree::Node *BinarySearchTree::GetLeftmostNode
-    (BinarySearchTree::Node *node) const {
-  while (node->left != nullptr) {
-    node = node->left;
-  }
-  return node;
-}
-
-BinarySearchTree::Node *BinarySearchTree::GetRightmostNode
-    (BinarySearchTree::Node *node) const {
-  while (node->right != nullptr) {
-    node = node->right;
-  }
-  return node;
-}
-
-void BinarySearchTree::AppendToSortedArray
-    (BinarySearchTree::Node *node, std::vector<int> *res) const {
-  if (node->left != nullptr) {
-    AppendToSortedArray(node->left, res);
-  }
-  res->push_back(node->value);
-  if (node->right != nullptr) {
-    AppendToSortedArray(node->right, res);
-  }
-}
+};
 
-int main() {
+void TestRandomQueries(Balancing balancing, NodeAllocation allocation,
+                       Duplicates duplicates, const std::string &config_name) {
   const int kQueriesCount = 50'000;
   const std::vector<int>
       kElementsMaxValues({1, 2, 5, 13, 42, 1024, 1'000'000'000});
@@ -219,7 +95,7 @@ int main() {
   std::mt19937_64 random_generator(2018);
   for (const int max_element_value : kElementsMaxValues) {
     std::vector<int> elements;
-    BinarySearchTree tree;
+    CheckedBinarySearchTree tree(balancing, allocation, duplicates);
 
     for (int i = 0; i < kQueriesCount; ++i) {
       int query_type = random_generator() % 3;
@@ -278,10 +154,507 @@ int main() {
 
       assert(elements.size() == tree.Size());
       assert(elements == tree.ToSortedArray());
+
+      int value = random_generator() % max_element_value;
+      value -= max_element_value / 2;
+      int rank = std::lower_bound(elements.begin(), elements.end(), value)
+          - elements.begin();
+      assert(tree.Rank(value) == rank);
+      if (!elements.empty()) {
+        int k = random_generator() % elements.size();
+        assert(tree.Select(k) == elements[k]);
+      }
+      int hi = value + random_generator() % max_element_value;
+      int expected_count =
+          std::lower_bound(elements.begin(), elements.end(), hi)
+              - elements.begin() - rank;
+      assert(tree.CountInRange(value, hi) == expected_count);
+
+      auto lower_bound = tree.LowerBound(value);
+      if (rank == static_cast<int>(elements.size())) {
+        assert(lower_bound == tree.end());
+      } else {
+        assert(*lower_bound == elements[rank]);
+      }
+      auto upper_bound = tree.UpperBound(value);
+      auto expected_upper_bound =
+          std::upper_bound(elements.begin(), elements.end(), value);
+      if (expected_upper_bound == elements.end()) {
+        assert(upper_bound == tree.end());
+      } else {
+        assert(*upper_bound == *expected_upper_bound);
+      }
+
+      // Полный обход в обе стороны стоит O(n), поэтому выполняется изредка
+      if (i % 100 == 0) {
+        assert(std::vector<int>(tree.begin(), tree.end()) == elements);
+        std::vector<int> reversed(std::make_reverse_iterator(tree.end()),
+                                  std::make_reverse_iterator(tree.begin()));
+        assert(std::equal(reversed.rbegin(), reversed.rend(),
+                          elements.begin(), elements.end()));
+
+        auto range = tree.Range(value, hi);
+        assert(std::distance(range.begin(), range.end()) == expected_count);
+        std::vector<int> in_range;
+        for (int element : range) {
+          in_range.push_back(element);
+        }
+        assert(std::equal(in_range.begin(), in_range.end(),
+                          elements.begin() + rank));
+      }
+      if (balancing == Balancing::kAvl || duplicates == Duplicates::kCounted) {
+        tree.CheckInvariants();
+      }
+    }
+
+    std::cout << "Passed: " << config_name
+              << ", max_element_value = " << max_element_value << std::endl;
+  }
+}
+
+// Рекурсивное удаление вершин переполнило бы стек на такой глубине
+void TestDegenerateTeardown(NodeAllocation allocation,
+                            const std::string &allocation_name) {
+  const int kChainLength = 1'000'000;
+
+  {
+    CheckedBinarySearchTree tree(Balancing::kNone, allocation);
+    tree.AppendDegenerateChain(kChainLength);
+    assert(tree.Size() == kChainLength);
+    assert(tree.Contains(kChainLength - 1));
+
+    // Обходы тоже не должны зависеть от глубины дерева
+    std::vector<int> sorted = tree.ToSortedArray();
+    assert(sorted.size() == kChainLength);
+    assert(std::is_sorted(sorted.begin(), sorted.end()));
+    long long visited_sum = 0;
+    tree.VisitInOrder([&visited_sum](int value) {
+      visited_sum += value;
+    });
+    assert(visited_sum == 1LL * kChainLength * (kChainLength - 1) / 2);
+
+    tree.Clear();
+    assert(tree.IsEmpty());
+    assert(tree.ToSortedArray().empty());
+
+    tree.Add(2);
+    tree.Add(1);
+    assert(tree.ToSortedArray() == std::vector<int>({1, 2}));
+
+    tree.AppendDegenerateChain(kChainLength);
+    // Остаток дерева удаляется деструктором
+  }
+
+  std::cout << "Passed: degenerate teardown, allocation = " << allocation_name
+            << std::endl;
+}
+
+// Удалённые вершины должны переиспользоваться, а не занимать новые слэбы
+void TestPoolReuse() {
+  const int kElementsCount = 10'000;
+  const int kRoundsCount = 10;
+
+  CheckedBinarySearchTree tree(Balancing::kAvl, NodeAllocation::kPool);
+  for (int i = 0; i < kElementsCount; ++i) {
+    tree.Add(i);
+  }
+  const size_t slabs_count = tree.PoolSlabsCount();
+  assert(slabs_count > 0);
+
+  std::mt19937_64 random_generator(2018);
+  for (int round = 0; round < kRoundsCount; ++round) {
+    for (int i = 0; i < kElementsCount; ++i) {
+      tree.Erase(i);
+    }
+    assert(tree.IsEmpty());
+
+    std::vector<int> values(kElementsCount);
+    for (int &value : values) {
+      value = random_generator() % kElementsCount;
+    }
+    for (int value : values) {
+      tree.Add(value);
+    }
+    std::sort(values.begin(), values.end());
+    assert(tree.ToSortedArray() == values);
+    tree.CheckInvariants();
+    assert(tree.PoolSlabsCount() == slabs_count);
+
+    for (int value : values) {
+      tree.Erase(value);
+    }
+    for (int i = 0; i < kElementsCount; ++i) {
+      tree.Add(i);
+    }
+  }
+
+  std::cout << "Passed: pool reuse" << std::endl;
+}
+
+void TestBulkBuild() {
+  const int kElementsCount = 20'000;
+  const int kElementsMaxValue = 1'000;
+  const std::vector<int> kBatchSizes({10, 30'000, 1, 500, 0});
+
+  std::mt19937_64 random_generator(2018);
+  for (Balancing balancing : {Balancing::kNone, Balancing::kAvl}) {
+    for (Duplicates duplicates : {Duplicates::kSeparateNodes, Duplicates::kCounted}) {
+      for (NodeAllocation allocation : {NodeAllocation::kHeap, NodeAllocation::kPool}) {
+        std::vector<int> elements(kElementsCount);
+        for (int &element : elements) {
+          element = random_generator() % kElementsMaxValue;
+        }
+        std::sort(elements.begin(), elements.end());
+
+        CheckedBinarySearchTree tree(balancing, allocation, duplicates);
+        tree.Add(-1);
+        tree.BuildFromSorted(elements.begin(), elements.end());
+        assert(tree.Size() == kElementsCount);
+        assert(tree.ToSortedArray() == elements);
+        tree.CheckInvariants();
+        if (allocation == NodeAllocation::kPool) {
+          assert(tree.PoolSlabsCount() == 1);
+        }
+
+        for (int batch_size : kBatchSizes) {
+          std::vector<int> batch(batch_size);
+          for (int &value : batch) {
+            value = random_generator() % kElementsMaxValue;
+          }
+          tree.InsertBatch(batch.begin(), batch.end());
+          elements.insert(elements.end(), batch.begin(), batch.end());
+          std::sort(elements.begin(), elements.end());
+          assert(tree.Size() == static_cast<int>(elements.size()));
+          assert(tree.ToSortedArray() == elements);
+          tree.CheckInvariants();
+
+          for (int i = 0; i < 100; ++i) {
+            int value = random_generator() % kElementsMaxValue;
+            int rank = std::lower_bound(elements.begin(), elements.end(), value)
+                - elements.begin();
+            assert(tree.Rank(value) == rank);
+          }
+        }
+
+        // Построенное дерево остаётся обычным деревом поиска
+        for (int i = 0; i < kElementsCount; ++i) {
+          int value = elements[random_generator() % elements.size()];
+          elements.erase(std::find(elements.begin(), elements.end(), value));
+          tree.Erase(value);
+          if (i % 2 == 0) {
+            value = random_generator() % kElementsMaxValue;
+            elements.insert(std::upper_bound(elements.begin(), elements.end(), value),
+                            value);
+            tree.Add(value);
+          }
+        }
+        assert(tree.ToSortedArray() == elements);
+        tree.CheckInvariants();
+
+        std::vector<int> unsorted({3, 1, 2});
+        bool thrown = false;
+        try {
+          tree.BuildFromSorted(unsorted.begin(), unsorted.end());
+        } catch (const std::invalid_argument &) {
+          thrown = true;
+        }
+        assert(thrown);
+        assert(tree.ToSortedArray() == elements);
+
+        tree.BuildFromSorted(unsorted.end(), unsorted.end());
+        assert(tree.IsEmpty());
+        tree.InsertBatch(unsorted.begin(), unsorted.end());
+        assert(tree.ToSortedArray() == std::vector<int>({1, 2, 3}));
+
+        // Пачки вставок, чередующиеся с удалениями, переиспользуют ячейки
+        // удалённых вершин и не заводят новых слэбов
+        std::vector<int> churn(5'000);
+        std::iota(churn.begin(), churn.end(), 10);
+        size_t slabs_count = 0;
+        for (int round = 0; round < 3; ++round) {
+          tree.InsertBatch(churn.begin(), churn.end());
+          for (int i = 0; i < 100; ++i) {
+            int value = -1 - i;
+            tree.InsertBatch(&value, &value + 1);
+          }
+          assert(tree.Size() == 3 + 5'100);
+          tree.CheckInvariants();
+          if (round == 0) {
+            slabs_count = tree.PoolSlabsCount();
+          }
+          assert(tree.PoolSlabsCount() == slabs_count);
+          for (int value : churn) {
+            tree.Erase(value);
+          }
+          for (int i = 0; i < 100; ++i) {
+            tree.Erase(-1 - i);
+          }
+          assert(tree.ToSortedArray() == std::vector<int>({1, 2, 3}));
+        }
+      }
     }
+  }
+
+  std::cout << "Passed: bulk build" << std::endl;
+}
+
+void TestFrozenIndex() {
+  const std::vector<int> kSizes({0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 100, 1'000, 4'097});
 
-    std::cout << "Passed: max_element_value = " << max_element_value << std::endl;
+  std::mt19937_64 random_generator(2018);
+  for (Duplicates duplicates : {Duplicates::kSeparateNodes, Duplicates::kCounted}) {
+    for (int size : kSizes) {
+      CheckedBinarySearchTree tree(Balancing::kAvl, NodeAllocation::kPool, duplicates);
+      for (int i = 0; i < size; ++i) {
+        tree.Add(random_generator() % (2 * size));
+      }
+      std::vector<int> distinct = tree.ToSortedArray();
+      distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+      FrozenSearchIndex<int> index = tree.Freeze();
+      assert(index.Size() == static_cast<int>(distinct.size()));
+      assert(index.IsEmpty() == tree.IsEmpty());
+      for (int value = -2; value < 2 * size + 2; ++value) {
+        assert(index.Contains(value) == tree.Contains(value));
+      }
+
+      // Индекс не зависит от последующих изменений дерева
+      tree.Clear();
+      for (int value : distinct) {
+        assert(index.Contains(value));
+      }
+    }
   }
 
+  BinarySearchTree<std::string, std::less<>> words;
+  for (const char *word : {"pear", "apple", "plum", "apple", "fig"}) {
+    words.Add(word);
+  }
+  FrozenSearchIndex<std::string, std::less<>> frozen_words = words.Freeze();
+  assert(frozen_words.Size() == 4);
+  assert(frozen_words.Contains(std::string_view("plum")));
+  assert(frozen_words.Contains("apple"));
+  assert(!frozen_words.Contains("banana"));
+  assert(!frozen_words.Contains("zucchini"));
+
+  std::cout << "Passed: frozen index" << std::endl;
+}
+
+// Ключ, копирование которого начинает бросать исключение после
+// copies_left успешных копий; отрицательное значение снимает ограничение
+struct ThrowingOnCopyKey {
+  static int copies_left;
+
+  int value;
+
+  explicit ThrowingOnCopyKey(int value) : value(value) {}
+  ThrowingOnCopyKey(const ThrowingOnCopyKey &other) : value(other.value) {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    if (copies_left > 0) {
+      --copies_left;
+    }
+  }
+
+  bool operator<(const ThrowingOnCopyKey &other) const {
+    return value < other.value;
+  }
+};
+
+int ThrowingOnCopyKey::copies_left = -1;
+
+// Аллокатор, считающий выделенные через него и ещё не освобождённые объекты
+template<typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  int *alive_count;
+
+  explicit CountingAllocator(int *alive_count) : alive_count(alive_count) {}
+  template<typename U>
+  CountingAllocator(const CountingAllocator<U> &other)
+      : alive_count(other.alive_count) {}
+
+  T *allocate(size_t count) {
+    *alive_count += count;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T *pointer, size_t count) {
+    *alive_count -= count;
+    std::allocator<T>().deallocate(pointer, count);
+  }
+
+  template<typename U>
+  bool operator==(const CountingAllocator<U> &other) const {
+    return alive_count == other.alive_count;
+  }
+  template<typename U>
+  bool operator!=(const CountingAllocator<U> &other) const {
+    return !(*this == other);
+  }
+};
+
+void TestGenericKeys() {
+  const std::vector<std::string> kWords({"pear", "apple", "plum", "apple",
+                                         "cherry", "fig", "banana"});
+
+  for (Balancing balancing : {Balancing::kNone, Balancing::kAvl}) {
+    // Прозрачный компаратор: поиск по std::string_view и строковому литералу
+    // без построения временной std::string
+    BinarySearchTree<std::string, std::less<>> words(balancing);
+    for (const std::string &word : kWords) {
+      words.Add(word);
+    }
+    std::string moved("kiwi");
+    words.Add(std::move(moved));
+
+    std::vector<std::string> expected(kWords);
+    expected.push_back("kiwi");
+    std::sort(expected.begin(), expected.end());
+    assert(words.ToSortedArray() == expected);
+
+    assert(words.Contains(std::string_view("cherry")));
+    assert(words.Contains("kiwi"));
+    assert(!words.Contains(std::string_view("grape")));
+    assert(words.Contains(std::string("fig")));
+
+    words.Erase(std::string_view("apple"));
+    assert(words.Contains("apple"));
+    words.Erase("apple");
+    assert(!words.Contains("apple"));
+    assert(words.Size() == static_cast<int>(expected.size()) - 2);
+
+    // Порядок задаётся компаратором
+    BinarySearchTree<int, std::greater<int>> descending(balancing);
+    for (int value : {3, 1, 4, 1, 5, 9, 2, 6}) {
+      descending.Add(value);
+    }
+    assert(descending.ToSortedArray() == std::vector<int>({9, 6, 5, 4, 3, 2, 1, 1}));
+    descending.Erase(1);
+    assert(descending.Contains(1));
+    assert(!descending.Contains(7));
+
+    // Порядковые статистики тоже следуют компаратору
+    assert(descending.Rank(4) == 3);
+    assert(descending.Select(0) == 9);
+    assert(descending.Select(6) == 1);
+    assert(descending.CountInRange(6, 2) == 4);
+    assert(descending.CountInRange(2, 6) == 0);
+    bool thrown = false;
+    try {
+      descending.Select(descending.Size());
+    } catch (const std::out_of_range &) {
+      thrown = true;
+    }
+    assert(thrown);
+
+    std::vector<int> in_range;
+    for (int value : descending.Range(6, 2)) {
+      in_range.push_back(value);
+    }
+    assert(in_range == std::vector<int>({6, 5, 4, 3}));
+    assert(*descending.UpperBound(9) == 6);
+    assert(descending.LowerBound(0) == descending.end());
+    assert(*--descending.end() == 1);
+
+    thrown = false;
+    try {
+      --descending.begin();
+    } catch (const std::out_of_range &) {
+      thrown = true;
+    }
+    assert(thrown);
+
+    std::string concatenated;
+    words.VisitInOrder([&concatenated](const std::string &word) {
+      concatenated += word[0];
+    });
+    assert(concatenated == "bcfkpp");
+
+    auto banana = words.LowerBound("b");
+    assert(banana->size() == 6);
+    assert(*++banana == "cherry");
+  }
+
+  // Вся память вершин берётся из переданного аллокатора и возвращается в него
+  for (NodeAllocation allocation : {NodeAllocation::kHeap, NodeAllocation::kPool}) {
+    int alive_count = 0;
+    {
+      using Tree = BinarySearchTree<std::string, std::less<>,
+                                    CountingAllocator<std::string>>;
+      Tree tree(Balancing::kAvl, allocation, Duplicates::kSeparateNodes,
+                std::less<>(), CountingAllocator<std::string>(&alive_count));
+      for (int i = 0; i < 5'000; ++i) {
+        tree.Add(std::to_string(i * 7919 % 5'000));
+      }
+      assert(alive_count >= 5'000);
+      for (int i = 0; i < 5'000; i += 2) {
+        tree.Erase(std::to_string(i));
+      }
+      assert(tree.Size() == 2'500);
+      tree.Clear();
+      assert(alive_count == 0);
+      tree.Add("again");
+    }
+    assert(alive_count == 0);
+  }
+
+  // Исключение посреди BuildFromSorted оставляет дерево пустым и не теряет
+  // памяти вершин
+  for (NodeAllocation allocation : {NodeAllocation::kHeap, NodeAllocation::kPool}) {
+    int alive_count = 0;
+    {
+      using Tree = BinarySearchTree<ThrowingOnCopyKey, std::less<ThrowingOnCopyKey>,
+                                    CountingAllocator<ThrowingOnCopyKey>>;
+      Tree tree(Balancing::kAvl, allocation, Duplicates::kCounted,
+                std::less<ThrowingOnCopyKey>(),
+                CountingAllocator<ThrowingOnCopyKey>(&alive_count));
+      std::vector<ThrowingOnCopyKey> keys;
+      keys.reserve(100);
+      for (int i = 0; i < 100; ++i) {
+        keys.emplace_back(i / 2);
+      }
+
+      ThrowingOnCopyKey::copies_left = 30;
+      bool thrown = false;
+      try {
+        tree.BuildFromSorted(keys.begin(), keys.end());
+      } catch (const std::runtime_error &) {
+        thrown = true;
+      }
+      ThrowingOnCopyKey::copies_left = -1;
+      assert(thrown);
+      assert(tree.IsEmpty());
+      if (allocation == NodeAllocation::kHeap) {
+        assert(alive_count == 0);
+      }
+
+      tree.BuildFromSorted(keys.begin(), keys.end());
+      assert(tree.Size() == 100);
+      assert(tree.Select(99).value == 49);
+    }
+    assert(alive_count == 0);
+  }
+
+  std::cout << "Passed: generic keys" << std::endl;
+}
+
+int main() {
+  TestRandomQueries(Balancing::kNone, NodeAllocation::kPool,
+                    Duplicates::kSeparateNodes, "none, pool, separate nodes");
+  TestRandomQueries(Balancing::kAvl, NodeAllocation::kHeap,
+                    Duplicates::kSeparateNodes, "AVL, heap, separate nodes");
+  TestRandomQueries(Balancing::kNone, NodeAllocation::kPool,
+                    Duplicates::kCounted, "none, pool, counted");
+  TestRandomQueries(Balancing::kAvl, NodeAllocation::kPool,
+                    Duplicates::kCounted, "AVL, pool, counted");
+  TestDegenerateTeardown(NodeAllocation::kHeap, "heap");
+  TestDegenerateTeardown(NodeAllocation::kPool, "pool");
+  TestPoolReuse();
+  TestBulkBuild();
+  TestFrozenIndex();
+  TestGenericKeys();
+
   return 0;
 }
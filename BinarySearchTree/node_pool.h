@@ -0,0 +1,156 @@
+#ifndef BINARYSEARCHTREE_NODE_POOL_H
+#define BINARYSEARCHTREE_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Источник памяти под объекты типа T, выделяющий её большими непрерывными
+// блоками (слэбами) по 'slab_size' объектов. Освобождённая через Deallocate()
+// память попадает в список свободных ячеек и выдаётся повторно в первую
+// очередь, поэтому при чередовании вставок и удалений новые слэбы не
+// заводятся. Системе память возвращается только в ReleaseAll(), все слэбы
+// разом за O(количества слэбов). Конструкторы и деструкторы объектов пул не
+// вызывает, это остаётся за пользователем. Слэбы выделяются через Allocator.
+//
+// AllocateBlock() выдаёт память под много объектов подряд отдельным слэбом
+// нужного размера; объекты из такого блока освобождаются по одному через
+// Deallocate(), как и выданные Allocate().
+template<typename T, typename Allocator = std::allocator<T>>
+class SlabPool {
+ public:
+  explicit SlabPool(const Allocator &allocator = Allocator(),
+                    size_t slab_size = 1024);
+  ~SlabPool();
+
+  SlabPool(const SlabPool &) = delete;
+  SlabPool &operator=(const SlabPool &) = delete;
+
+  // Возвращает неинициализированную память под один объект
+  void *Allocate();
+  // Возвращает неинициализированную память под count объектов подряд
+  T *AllocateBlock(size_t count);
+  // Объект, память которого передана сюда, должен быть уже разрушен
+  void Deallocate(void *pointer);
+
+  // Освобождает все слэбы; выданная ранее память становится недействительной
+  void ReleaseAll();
+
+  size_t SlabsCount() const;
+  // Сколько объектов можно выделить через Allocate() без нового слэба
+  size_t FreeCount() const;
+  size_t SlabSize() const;
+
+ private:
+  // Свободная ячейка хранит указатель на следующую свободную ячейку
+  // в памяти, предназначенной для объекта
+  union Slot {
+    Slot *next_free;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  using SlotAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using SlotAllocatorTraits = std::allocator_traits<SlotAllocator>;
+
+  struct Slab {
+    typename SlotAllocatorTraits::pointer slots;
+    size_t size;
+  };
+
+  SlotAllocator allocator_;
+  size_t slab_size_;
+  std::vector<Slab> slabs_;
+  // Слэб, из которого ячейки выдаются по одной, и количество выданных из него
+  // ячеек
+  Slot *current_slab_;
+  size_t used_in_current_slab_;
+  Slot *free_list_;
+  size_t free_list_size_;
+
+  Slot *AllocateSlab(size_t size);
+};
+
+template<typename T, typename Allocator>
+SlabPool<T, Allocator>::SlabPool(const Allocator &allocator, size_t slab_size)
+    : allocator_(allocator), slab_size_(slab_size), current_slab_(nullptr),
+      used_in_current_slab_(0), free_list_(nullptr), free_list_size_(0) {}
+
+template<typename T, typename Allocator>
+SlabPool<T, Allocator>::~SlabPool() {
+  ReleaseAll();
+}
+
+template<typename T, typename Allocator>
+void *SlabPool<T, Allocator>::Allocate() {
+  if (free_list_ != nullptr) {
+    Slot *slot = free_list_;
+    free_list_ = slot->next_free;
+    --free_list_size_;
+    return slot->storage;
+  }
+  if (current_slab_ == nullptr || used_in_current_slab_ == slab_size_) {
+    current_slab_ = AllocateSlab(slab_size_);
+    used_in_current_slab_ = 0;
+  }
+  return current_slab_[used_in_current_slab_++].storage;
+}
+
+template<typename T, typename Allocator>
+T *SlabPool<T, Allocator>::AllocateBlock(size_t count) {
+  // Ячейки блока должны идти с шагом sizeof(T), чтобы блок был массивом T
+  static_assert(sizeof(Slot) == sizeof(T),
+                "T should be at least as large and aligned as a pointer");
+  return reinterpret_cast<T *>(AllocateSlab(count));
+}
+
+template<typename T, typename Allocator>
+void SlabPool<T, Allocator>::Deallocate(void *pointer) {
+  Slot *slot = static_cast<Slot *>(pointer);
+  slot->next_free = free_list_;
+  free_list_ = slot;
+  ++free_list_size_;
+}
+
+template<typename T, typename Allocator>
+void SlabPool<T, Allocator>::ReleaseAll() {
+  for (const Slab &slab : slabs_) {
+    SlotAllocatorTraits::deallocate(allocator_, slab.slots, slab.size);
+  }
+  slabs_.clear();
+  current_slab_ = nullptr;
+  used_in_current_slab_ = 0;
+  free_list_ = nullptr;
+  free_list_size_ = 0;
+}
+
+template<typename T, typename Allocator>
+size_t SlabPool<T, Allocator>::SlabsCount() const {
+  return slabs_.size();
+}
+
+template<typename T, typename Allocator>
+size_t SlabPool<T, Allocator>::FreeCount() const {
+  size_t left_in_current_slab =
+      (current_slab_ != nullptr) ? slab_size_ - used_in_current_slab_ : 0;
+  return free_list_size_ + left_in_current_slab;
+}
+
+template<typename T, typename Allocator>
+size_t SlabPool<T, Allocator>::SlabSize() const {
+  return slab_size_;
+}
+
+template<typename T, typename Allocator>
+typename SlabPool<T, Allocator>::Slot *SlabPool<T, Allocator>::AllocateSlab(size_t size) {
+  // Место под запись о слэбе резервируется заранее, чтобы не потерять
+  // выделенный слэб при исключении из push_back
+  if (slabs_.size() == slabs_.capacity()) {
+    slabs_.reserve(2 * slabs_.size() + 1);
+  }
+  Slab slab{SlotAllocatorTraits::allocate(allocator_, size), size};
+  slabs_.push_back(slab);
+  return std::addressof(*slab.slots);
+}
+
+#endif //BINARYSEARCHTREE_NODE_POOL_H